@@ -755,6 +755,20 @@
   #define MPC_MIN_AMBIENT_CHANGE 1.0f                 // (K/s) Modeled ambient temperature rate of change, when correcting model inaccuracies.
   #define MPC_STEADYSTATE 0.5f                        // (K/s) Temperature change rate for steady state logic to be enforced.
 
+  //#define MPC_FAULT_DETECTION                       // Stop when the hotend stops following the model, e.g., a failed heater or loose thermistor.
+  #if ENABLED(MPC_FAULT_DETECTION)                    // Requires a tuned model. Faster than THERMAL_PROTECTION_HOTENDS and not fooled by extrusion or fan.
+    #define MPC_FAULT_DRIFT 1.0f                      // (K/s) Prediction error to ignore. Raise if a poorly tuned model trips.
+    #define MPC_FAULT_LIMIT 20.0f                     // (K) Error beyond the drift to accumulate before a fault. Higher is more certain but slower.
+    #if ENABLED(MPC_INCLUDE_FAN)
+      #define MPC_FAULT_FAN_AMBIENT 60.0f             // (°C) Warn of a failed part cooling fan if the modeled ambient passes this with the fan over 50%.
+    #endif
+  #endif
+
+  //#define MPC_FEEDFORWARD                           // Plan heater power for the extrusion and fan speeds coming up in the planner queue.
+  #if ENABLED(MPC_FEEDFORWARD)
+    #define MPC_FEEDFORWARD_TIME 2.0f                 // (s) How far ahead to look. About the time the heat block takes to respond.
+  #endif
+
   #define MPC_TUNING_POS { X_CENTER, Y_CENTER, 1.0f } // (mm) M306 Autotuning position, ideally bed center at first layer height.
   #define MPC_TUNING_END_Z 10.0f                      // (mm) M306 Autotuning final Z position.
 #endif
@@ -3444,6 +3458,23 @@
 
   //#define TFT_SHARED_IO   // I/O is shared between TFT display and other devices. Disable async data transfer.
 
+  /**
+   * Split the TFT buffer in two halves. The next band of the screen is drawn
+   * in one half while DMA sends the other. Use M257 to see update statistics.
+   */
+  //#define TFT_DOUBLE_BUFFER
+
+  /**
+   * Keep recently drawn glyphs in RAM as ready-to-copy pixel runs, so redrawn
+   * text skips decoding the font bitmaps. The least recently used are dropped.
+   * Reduce the size on boards with little RAM (e.g., STM32F1).
+   */
+  //#define TFT_GLYPH_CACHE
+  #if ENABLED(TFT_GLYPH_CACHE)
+    #define TFT_GLYPH_CACHE_SIZE   8192 // (bytes) Pixel storage. About 300 bytes per glyph for a 480x320 display.
+    #define TFT_GLYPH_CACHE_GLYPHS   48 // Maximum number of glyphs (1-255)
+  #endif
+
   #define COMPACT_MARLIN_BOOT_LOGO  // Use compressed data to save Flash space
 #endif
 
@@ -3501,6 +3532,18 @@
   #if ENABLED(TFT_COLOR_UI)
     //#define SINGLE_TOUCH_NAVIGATION
   #endif
+
+  /**
+   * Sample an XPT2046 touch panel from the temperature interrupt instead of the UI loop,
+   * so taps and drags aren't lost while the main loop is busy. Requires touch SPI pins
+   * not shared with the TFT or SD card. The panel is then read with software SPI.
+   */
+  //#define TOUCH_ISR_SAMPLING
+  #if ENABLED(TOUCH_ISR_SAMPLING)
+    #define TOUCH_SAMPLE_DEBOUNCE 3 // Samples (about 6ms each) to confirm a press. Minimum 3.
+    #define TOUCH_IIR_SHIFT       2 // Position smoothing. Higher is smoother but lags more. 0 to disable.
+    #define TOUCH_EVENT_QUEUE     8 // Press/move/release events held for the UI
+  #endif
 #endif
 
 //
@@ -3543,6 +3586,13 @@
 // duty cycle is attained.
 //#define SOFT_PWM_DITHER
 
+// Sigma-delta modulation for software PWM heaters and fans. Instead of one on-pulse
+// per PWM period the on-time is spread evenly over every temperature ISR tick, so a
+// heater at 10% power switches once every ten ticks. This gives the full resolution
+// (128 heater / 256 fan steps) at the highest ripple frequency, with the same ISR cost.
+// Don't use with slow-switching heaters such as mechanical relays.
+//#define SOFT_PWM_SIGMA_DELTA
+
 // @section extras
 
 // Support for the BariCUDA Paste Extruder
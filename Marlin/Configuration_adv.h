@@ -170,6 +170,25 @@
   #define REDUNDANT_SH_C_COEFF               0 // Steinhart-Hart C coefficient
 #endif
 
+/**
+ * Convert thermistor readings with a direct index into the thermistor tables
+ * instead of a bisection search and float math. Custom (1000) thermistors get
+ * a table in RAM, rebuilt when changed with M305. (About 420 bytes each.)
+ */
+//#define THERMISTOR_DIRECT_INDEX
+
+/**
+ * Sample all analog sensors continuously with the ADC in scan mode (using DMA
+ * where required) and feed the thermal channels to the temperature ISR in one
+ * batch. Sensor update time no longer grows with the number of sensors.
+ * Supported on STM32F1, STM32F4, STM32G0 and LPC176x.
+ */
+//#define ADC_SCAN_SAMPLING
+#if ENABLED(ADC_SCAN_SAMPLING)
+  #define ADC_SCAN_OVERSAMPLE 16  // (2..32, power of 2) (STM32) Conversions averaged per value. In hardware on STM32G0.
+  //#define ADC_SCAN_DMA_STREAM 4 // (0|4) (STM32F4) DMA2 stream for ADC1. Stream 0 is shared with FSMC TFT and SPI flash.
+#endif
+
 /**
  * Thermocouple Options — for MAX6675 (-2), MAX31855 (-3), and MAX31865 (-5).
  */
@@ -189,6 +208,9 @@
 //#define MAX31865_WIRE_OHMS_1              0.0f
 //#define MAX31865_WIRE_OHMS_2              0.0f
 
+//#define MAX_TC_SCHEDULER                        // Read one board per idle pass, each as soon as its conversion is ready,
+                                                  // instead of all boards back-to-back. Report SPI read time and bus use with 'M105 S'.
+
 /**
  * Hephestos 2 24V heated bed upgrade kit.
  * https://www.en3dstudios.com/product/bq-hephestos-2-heated-bed-kit/
@@ -476,6 +498,7 @@
  *  behavior using an additional kC value.)
  *
  * Autotemp is calculated by (mintemp + factor * mm_per_sec), capped to maxtemp.
+ * With AUTOTEMP_VOLUMETRIC it follows a per-material flow curve (see below).
  *
  * Enable Autotemp Mode with M104/M109 F<factor> S<mintemp> B<maxtemp>.
  * Disable by sending M104/M109 with no F parameter (or F0 with AUTOTEMP_PROPORTIONAL).
@@ -493,6 +516,22 @@
     #define AUTOTEMP_MAX_P      5 // (°C) Added to the target temperature
     #define AUTOTEMP_FACTOR_P   1 // Apply this F parameter by default (overridden by M104/M109 F)
   #endif
+
+  /**
+   * Volumetric Autotemp
+   * Use the volumetric flow (mm^3/s) averaged over the next few seconds of queued
+   * moves instead of the peak E speed, so the hotend heats up ahead of high-flow
+   * segments. Each material has a curve giving the °C to add to the minimum at
+   * each flow point. Autotemp is then (mintemp + factor * boost), so F1 applies
+   * the curve as set. Select and edit curves with M124 and save them with M500.
+   */
+  //#define AUTOTEMP_VOLUMETRIC
+  #if ENABLED(AUTOTEMP_VOLUMETRIC)
+    #define AUTOTEMP_FLOW_WINDOW  2.0               // (s) Look-ahead time to average the flow over
+    #define AUTOTEMP_FLOW_POINTS  { 0, 5, 10, 15, 20 } // (mm^3/s) Flow at each curve point, increasing
+    #define AUTOTEMP_FLOW_CURVES  { { 0, 4, 10, 18, 25 }, /* PLA  */ \
+                                    { 0, 3,  7, 12, 16 }  /* PETG */ } // (°C) Boost per material
+  #endif
 #endif
 
 // Show Temperature ADC value
@@ -529,6 +568,14 @@
 //#define PREHEAT_TIME_HOTEND_MS 0
 //#define PREHEAT_TIME_BED_MS 0
 
+/**
+ * Heat up and continue
+ * Return from M109 / M190 right away while heating so that homing, probing,
+ * and travel moves can proceed. The first extruding move waits for the bed and its own hotend.
+ * Use M109 W / M190 W to wait right away.
+ */
+//#define HEATUP_AND_CONTINUE
+
 // @section extruder
 
 /**
@@ -565,6 +612,21 @@
 #define TEMP_SENSOR_AD8495_OFFSET 0.0
 #define TEMP_SENSOR_AD8495_GAIN   1.0
 
+/**
+ * Heater Power Budget
+ * Keep the combined power of the hotend, bed and chamber heaters within the
+ * capacity of a shared power supply. When heaters ask for more than the limit
+ * those closest to their target temperature are served first. Heater on-times
+ * are staggered through the PWM period so they don't all switch on together.
+ */
+//#define HEATER_POWER_BUDGET
+#if ENABLED(HEATER_POWER_BUDGET)
+  #define HEATER_POWER_LIMIT     300    // (W) Total power available to the heaters
+  #define HOTEND_HEATER_POWER  { 40 }   // (W) Power of each hotend heater
+  #define BED_HEATER_POWER       250    // (W)
+  #define CHAMBER_HEATER_POWER   500    // (W)
+#endif
+
 // @section fans
 
 /**
@@ -666,6 +728,17 @@
   #endif
 #endif
 
+/**
+ * Hardware PWM for heaters
+ * Drive hotend and bed heaters on timer-capable pins with hardware PWM, taking them out of
+ * the software PWM in the temperature ISR. Heaters on other pins keep using software PWM.
+ * Check that the heater pin timers are not shared with the stepper, temperature or servo timers.
+ */
+//#define HARDWARE_PWM_HEATERS
+#if ENABLED(HARDWARE_PWM_HEATERS)
+  #define HARDWARE_PWM_HEATERS_FREQUENCY 1000 // (Hz) Keep low enough for the MOSFET drivers
+#endif
+
 /**
  * Assign more PWM fans for part cooling, synchronized with Fan 0
  */
@@ -1619,6 +1692,34 @@
     //#define DOUBLE_LCD_FRAMERATE        // Not recommended for slow boards.
   #endif
 
+  #if HAS_WIRED_LCD
+    /**
+     * Put off screen drawing while the planner would run out of moves before
+     * it finishes. Buttons and the encoder are still read on time. The screen
+     * catches up once the buffer refills. Use M257 to see how often drawing
+     * was held back.
+     */
+    //#define UI_PLANNER_BUDGET
+    #if ENABLED(UI_PLANNER_BUDGET)
+      #define UI_HEADROOM_PERCENT  50     // Share of the queued move time the UI may use
+      #define UI_MAX_DEFER_MS    1000     // (ms) Longest time to hold back the UI
+    #endif
+  #endif
+
+  #if HAS_MARLINUI_MENU
+    /**
+     * Record how long each screen takes to draw and send, how many bytes go
+     * to the display, and a hash of that data for the last frame. M257 lists
+     * the totals per screen and can also scroll and click through menus,
+     * so buildroot/share/scripts/ui_bench.py can time a scripted walk
+     * through the UI and compare each frame with known-good hashes.
+     */
+    //#define UI_RENDER_STATS
+    #if ENABLED(UI_RENDER_STATS)
+      #define UI_RENDER_SCREENS 8         // Screens to keep separate totals for
+    #endif
+  #endif
+
   // The timeout to return to the status screen from sub-menus
   //#define LCD_TIMEOUT_TO_STATUS 15000   // (ms)
 
@@ -1727,6 +1828,13 @@
   //#define SD_IGNORE_AT_STARTUP            // Don't mount the SD card when starting up
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
 
+  //#define SD_CLUSTER_CACHE                // Cache the cluster chain of open files for faster reads and seeks
+  #if ENABLED(SD_CLUSTER_CACHE)
+    #define SD_CLUSTER_CACHE_RUNS 8         // Runs of consecutive clusters to cache per file (1-255). 8 bytes each, per SdBaseFile.
+  #endif
+
+  //#define SD_STREAM_READS                 // Use multi-block reads (CMD18) for sequential reads from an SPI SD card. Report MB/s with 'M27 R'.
+
   //#define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
@@ -1784,6 +1892,16 @@
       //#define POWER_LOSS_RETRACT_LEN   10 // (mm) Length of filament to retract on fail
     #endif
 
+    // Between full saves, checkpoint the SD position, XYZE and target temperatures to a ring
+    // of sectors in a contiguous recovery file. Each checkpoint is one raw block write made from
+    // idle() when the planner has moves to spare. Full saves only happen at job start and pause.
+    // Needs 512 bytes of RAM for the sector buffer.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_SECTORS  16 // Journal ring size in 512-byte sectors. More sectors spread card wear.
+      #define POWER_LOSS_JOURNAL_MS     2000 // (ms) Checkpoint interval while printing
+    #endif
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1830,6 +1948,13 @@
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
   #endif
 
+  // Index the items of the current folder in RAM so menus, sorting and file
+  // selection seek straight to a file instead of re-reading the folder.
+  //#define SD_DIR_INDEX
+  #if ENABLED(SD_DIR_INDEX)
+    #define SD_DIR_INDEX_LIMIT 256        // Maximum number of indexed items. Costs 4 bytes each.
+  #endif
+
   // Allow international symbols in long filenames. To display correctly, the
   // LCD's font must contain the characters. Check your selected LCD language.
   //#define UTF_FILENAME_SUPPORT
@@ -1981,6 +2106,17 @@
   //#define XYZ_NO_FRAME
   #define XYZ_HOLLOW_FRAME
 
+  // Only send the display stripes that changed since the last update.
+  // Saves a lot of bus time with software SPI displays. Costs about 40 bytes of RAM.
+  //#define DOGM_DIRTY_PAGES
+  #if ENABLED(DOGM_DIRTY_PAGES)
+    #define DOGM_FULL_REFRESH_SECONDS 30  // Resend everything this often to clear display glitches. 0 to disable.
+  #endif
+
+  // After the first display page of a menu update, only process the menu rows
+  // that fall on each page. Saves many cycles on displays drawn in 2 to 8 pages.
+  //#define MENU_PAGE_CULLING
+
   // A bigger font is available for edit items. Costs 3120 bytes of flash.
   // Western only. Not available for Cyrillic, Kana, Turkish, Greek, or Chinese.
   //#define USE_BIG_EDIT_FONT
@@ -2059,6 +2195,18 @@
 
   #define DGUS_UPDATE_INTERVAL_MS  500    // (ms) Interval between automatic screen updates
 
+  /**
+   * Send only the display variables that have changed, and merge writes to
+   * neighboring variables into a single frame. Reduces serial traffic so the
+   * screen keeps up during busy prints. (ORIGIN, FYSETC, HIPRECY, MKS)
+   */
+  //#define EXTUI_DIFF_UPDATES
+  #if ENABLED(EXTUI_DIFF_UPDATES)
+    #define EXTUI_DIFF_VARS        32     // Number of variables to remember. Collisions are simply resent.
+    #define EXTUI_FIELD_MIN_MS   1000     // (ms) Minimum time between automatic updates of a changing value
+    #define EXTUI_RESEND_MS      5000     // (ms) Resend unchanged values in case the display was reset
+  #endif
+
   #if DGUS_UI_IS(FYSETC, MKS, HIPRECY)
     #define DGUS_PRINT_FILENAME           // Display the filename during printing
     #define DGUS_PREHEAT_UI               // Display a preheat screen during heatup
@@ -2099,6 +2247,22 @@
   #endif
 #endif // HAS_DGUS_LCD
 
+//
+// Additional options for Ender-3 V2 style DWIN displays
+//
+#if ANY(HAS_DWIN_E3V2, IS_DWIN_MARLINUI)
+  /**
+   * Queue drawing commands in RAM and pass them to the serial port only as
+   * fast as it can take them, so screen redraws don't hold up the printer.
+   * A value redrawn in the same place before the last one went out replaces it.
+   * (STM32, STM32F1, HC32)
+   */
+  //#define DWIN_TX_QUEUE
+  #if ENABLED(DWIN_TX_QUEUE)
+    #define DWIN_TX_QUEUE_SIZE 1024       // (bytes) Room for queued commands
+  #endif
+#endif
+
 //
 // Additional options for AnyCubic Chiron TFT displays
 //
@@ -2723,6 +2887,10 @@
  * Note: This has no effect on emulated USB serial ports.
  */
 //#define SERIAL_DMA
+#if ENABLED(SERIAL_DMA)
+  //#define SERIAL_DMA_LINE_SCAN  // (STM32) Scan the DMA ring for whole lines and copy them straight into the command queue.
+                                  // Peak RX usage and ring overruns are added to the D576 report.
+#endif
 
 /**
  * Set the number of proportional font spaces required to fill up a typical character space.
@@ -3929,6 +4097,14 @@
   //#define AUTO_REPORT_REDUNDANT // Include the "R" sensor in the auto-report
 #endif
 
+/**
+ * Heater trace logging with M155 L1
+ * Report the temperature, target, power, fan speed and E position of every
+ * heater after each temperature update. Use buildroot/share/scripts/thermal_fit.py
+ * to fit a heater model from the log for tuning on the native simulator.
+ */
+//#define THERMAL_TRACE
+
 /**
  * Auto-report position with M154 S<seconds>
  */
@@ -89,7 +89,7 @@
     static_assert(false, "LCD_SERIAL_PORT must be from 1 to " STRINGIFY(NUM_UARTS) ".")
   #endif
 
-  #if HAS_DGUS_LCD
+  #if ANY(HAS_DGUS_LCD, DWIN_TX_QUEUE)
     #define LCD_SERIAL_TX_BUFFER_FREE() LCD_SERIAL.availableForWrite()
   #endif
 #endif
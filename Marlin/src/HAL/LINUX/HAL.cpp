@@ -50,12 +50,26 @@ int freeMemory() { return 0; }
 
 uint8_t MarlinHAL::active_ch = 0;
 
-uint16_t MarlinHAL::adc_value() {
-  const pin_t pin = analogInputToDigitalPin(active_ch);
+static uint16_t adc_read(const uint8_t ch) {
+  const pin_t pin = analogInputToDigitalPin(ch);
   if (!isValidPin(pin)) return 0;
   return uint16_t((Gpio::get(pin) >> 2) & 0x3FF); // return 10bit value as Marlin expects
 }
 
+uint16_t MarlinHAL::adc_value() { return adc_read(active_ch); }
+
+#if ENABLED(ADC_SCAN_SAMPLING)
+
+  static uint8_t adc_scan_ch[HAL_ADC_SCAN_MAX];
+
+  void MarlinHAL::adc_scan_init(const pin_t pins[], const uint8_t count) {
+    for (uint8_t i = 0; i < _MIN(count, HAL_ADC_SCAN_MAX); ++i) adc_scan_ch[i] = pins[i];
+  }
+
+  uint16_t MarlinHAL::adc_scan_value(const uint8_t index) { return adc_read(adc_scan_ch[index]); }
+
+#endif
+
 void MarlinHAL::reboot() { /* Reset the application state and GPIO */ }
 
 // ------------------------
@@ -87,6 +87,7 @@ extern MSerialT usb_serial;
 // ADC
 #define HAL_ADC_VREF_MV   5000
 #define HAL_ADC_RESOLUTION  10
+#define HAL_ADC_SCAN_MAX    16
 
 // ------------------------
 // Class Utilities
@@ -158,6 +159,14 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value();
 
+  #if ENABLED(ADC_SCAN_SAMPLING)
+    // Called by Temperature::init once with the channels to read as a batch
+    static void adc_scan_init(const pin_t pins[], const uint8_t count);
+
+    // The current value of the channel in the given scan slot
+    static uint16_t adc_scan_value(const uint8_t index);
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * No option to change the resolution or invert the duty cycle.
@@ -37,6 +37,10 @@ uint32_t millis() {
   return (uint32_t)Clock::millis();
 }
 
+uint32_t micros() {
+  return (uint32_t)Clock::micros();
+}
+
 // This is required for some Arduino libraries we are using
 void delayMicroseconds(uint32_t us) {
   Clock::delayMicros(us);
@@ -65,7 +69,7 @@ bool digitalRead(pin_t pin) {
 
 void analogWrite(pin_t pin, int pwm_value) {  // 1 - 254: pwm_value, 0: LOW, 255: HIGH
   if (!isValidPin(pin)) return;
-  Gpio::set(pin, pwm_value);
+  Gpio::set(pin, pwm_value, true);
 }
 
 uint16_t analogRead(pin_t adc_pin) {
@@ -64,6 +64,7 @@ struct pin_data {
   uint8_t dir;
   uint8_t mode;
   uint16_t value;
+  bool pwm;         // value is an analogWrite duty (0-255), not a logic level
   Peripheral* cb;
 };
 
@@ -81,10 +82,11 @@ public:
     set(pin, 1);
   }
 
-  static void set(pin_type pin, uint16_t value) {
+  static void set(pin_type pin, uint16_t value, const bool pwm=false) {
     if (!valid_pin(pin)) return;
     GpioEvent::Type evt_type = value > 1 ? GpioEvent::SET_VALUE : value > pin_map[pin].value ? GpioEvent::RISE : value < pin_map[pin].value ? GpioEvent::FALL : GpioEvent::NOP;
     pin_map[pin].value = value;
+    pin_map[pin].pwm = pwm;
     GpioEvent evt(Clock::nanos(), pin, evt_type);
     if (pin_map[pin].cb) {
       pin_map[pin].cb->interrupt(evt);
@@ -23,34 +23,89 @@
 
 #include "Clock.h"
 #include <stdio.h>
+#include <string.h>
 #include "../../../inc/MarlinConfig.h"
 
 #include "Heater.h"
 
-Heater::Heater(pin_t heater, pin_t adc) {
-  heater_state = 0;
-  room_temp_raw = 150;
+bool ThermalPlant::load(const char * const path) {
+  FILE *f = fopen(path, "r");
+  if (!f) return false;
+  char line[128], key[64];
+  double value;
+  while (fgets(line, sizeof(line), f)) {
+    if (sscanf(line, " %63[a-z_] = %lf", key, &value) != 2) continue; // Skip comments and blank lines
+    if      (!strcmp(key, "heater_power"))    heater_power = value;
+    else if (!strcmp(key, "heat_capacity"))   heat_capacity = value;
+    else if (!strcmp(key, "ambient_xfer"))    ambient_xfer = value;
+    else if (!strcmp(key, "fan_xfer"))        fan_xfer = value;
+    else if (!strcmp(key, "filament_heat"))   filament_heat = value;
+    else if (!strcmp(key, "sensor_response")) sensor_response = value;
+    else if (!strcmp(key, "ambient_temp"))    ambient_temp = value;
+  }
+  fclose(f);
+  return true;
+}
+
+Heater::Heater(pin_t heater, pin_t adc, const temp_entry_t *table, uint8_t table_len, const ThermalPlant &plant)
+  : heater_pin(heater), adc_pin(adc), fan_pin(P_NC), table(table), table_len(table_len), plant(plant),
+    extruder(nullptr), e_steps_per_mm(1), e_position(0)
+{
+  block_temp = sensor_temp = plant.ambient_temp;
   last = Clock::micros();
-  heater_pin = heater;
-  adc_pin = adc;
-  heat = 0.0;
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = celsius_to_adc(sensor_temp);
 }
 
 Heater::~Heater() {
 }
 
+// An analogWrite duty or a digital state as 0..1
+static double output_level(const pin_t pin) {
+  const pin_data &p = Gpio::pin_map[pin];
+  return p.pwm ? p.value / 255.0 : (p.value ? 1.0 : 0.0);
+}
+
+// Convert a temperature to the pin value read by the ADC, interpolating the thermistor table
+uint16_t Heater::celsius_to_adc(const double celsius) {
+  if (!table_len) return 0;
+  double raw = table[table_len - 1].value;
+  if ((celsius - table[0].celsius) * (table[table_len - 1].celsius - table[0].celsius) <= 0)
+    raw = table[0].value;
+  else for (uint8_t i = 1; i < table_len; ++i) {
+    const double c0 = table[i - 1].celsius, c1 = table[i].celsius;
+    if ((celsius - c0) * (celsius - c1) <= 0) {
+      raw = table[i - 1].value + (celsius - c0) * (double(table[i].value) - table[i - 1].value) / (c1 - c0);
+      break;
+    }
+  }
+  // The Linux HAL returns the pin value >> 2 as a 10-bit reading
+  return uint16_t(raw / ((OVERSAMPLENR) * (THERMISTOR_TABLE_SCALE))) << 2;
+}
+
 void Heater::update() {
-  // crude pwm read and cruder heat simulation
   auto now = Clock::micros();
-  double delta = (now - last);
-  if (delta > 1000 ) {
-    heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
-    last = now;
-    heat += (heater_state - heat) * (delta / 1000000000.0);
-
-    NOLESS(heat, room_temp_raw);
-    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = 0xFFFF - (uint16_t)heat;
+  const double dt = (now - last) / 1000000.0;
+  if (dt < 0.001) return;
+  last = now;
+
+  // Outputs are sampled, so soft PWM averages out over time
+  const double heating = output_level(heater_pin) * plant.heater_power,
+               fan = fan_pin == P_NC ? 0.0 : output_level(fan_pin);
+
+  double e_mm = 0;
+  if (extruder) {
+    e_mm = (extruder->position - e_position) / e_steps_per_mm;
+    e_position = extruder->position;
+    NOLESS(e_mm, 0);                            // Retracted filament takes no heat
   }
+
+  const double dtemp = block_temp - plant.ambient_temp,
+               loss = (plant.ambient_xfer + fan * plant.fan_xfer) * dtemp * dt + plant.filament_heat * e_mm * dtemp;
+
+  block_temp += (heating * dt - loss) / plant.heat_capacity;
+  sensor_temp += (block_temp - sensor_temp) * _MIN(plant.sensor_response * dt, 1.0);
+
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = celsius_to_adc(sensor_temp);
 }
 
 void Heater::interrupt(GpioEvent ev) {
@@ -22,26 +22,46 @@
 #pragma once
 
 #include "Gpio.h"
+#include "LinearAxis.h"
+#include "../../../module/thermistor/thermistors.h"
 
-struct LowpassFilter {
-  uint64_t data_delay = 0;
-  uint16_t update(uint16_t value) {
-    data_delay += value - (data_delay >> 6);
-    return uint16_t(data_delay >> 6);
-  }
+/**
+ * Lumped thermal model of a heater block and its temperature sensor.
+ * Fitted values can be loaded from a "key = value" file written by
+ * buildroot/share/scripts/thermal_fit.py.
+ */
+struct ThermalPlant {
+  double heater_power;      // (W) Heater output at full power
+  double heat_capacity;     // (J/K) Heat capacity of the block
+  double ambient_xfer;      // (W/K) Heat loss to ambient with the fan off
+  double fan_xfer;          // (W/K) Additional heat loss with the fan at full speed
+  double filament_heat;     // (J/K/mm) Heat carried away per mm of filament extruded
+  double sensor_response;   // (1/s) Sensor responsiveness to the block temperature
+  double ambient_temp;      // (°C) Ambient temperature
+
+  bool load(const char * const path);
 };
 
 class Heater: public Peripheral {
 public:
-  Heater(pin_t heater, pin_t adc);
+  Heater(pin_t heater, pin_t adc, const temp_entry_t *table, uint8_t table_len, const ThermalPlant &plant);
   virtual ~Heater();
   void interrupt(GpioEvent ev);
   void update();
 
-  pin_t heater_pin, adc_pin;
-  uint16_t room_temp_raw;
-  uint16_t heater_state;
-  LowpassFilter pwmcap;
-  double heat;
+  void attach_fan(const pin_t fan) { fan_pin = fan; }
+  void attach_extruder(const LinearAxis *axis, const double steps_per_mm) { extruder = axis; e_steps_per_mm = steps_per_mm; }
+
+  pin_t heater_pin, adc_pin, fan_pin;
+  const temp_entry_t *table;
+  uint8_t table_len;
+  ThermalPlant plant;
+  const LinearAxis *extruder;
+  double e_steps_per_mm;
+  int32_t e_position;
+  double block_temp, sensor_temp;
   uint64_t last;
+
+private:
+  uint16_t celsius_to_adc(const double celsius);
 };
@@ -32,6 +32,7 @@
 #include "hardware/LinearAxis.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
 #include <thread>
 #include <iostream>
@@ -61,14 +62,34 @@ void read_serial_thread() {
   }
 }
 
+// Load a heater model from the file named by an environment variable, if set
+static ThermalPlant load_plant(const char * const env, const ThermalPlant &defaults) {
+  ThermalPlant plant = defaults;
+  const char * const path = getenv(env);
+  if (path && !plant.load(path)) fprintf(stderr, "Unable to read %s=%s\n", env, path);
+  return plant;
+}
+
 void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
+  // Default hotend: 40W cartridge in an aluminum block. Bed: 250W, 220x220 aluminum.
+  static const ThermalPlant hotend_plant = { 40.0, 16.7, 0.068, 0.029, 0.0056, 0.22, 25.0 };
+  constexpr float steps_per_unit[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+
+  Heater hotend(HEATER_0_PIN, TEMP_0_PIN, TEMPTABLE_0, TEMPTABLE_0_LEN, load_plant("MARLIN_SIM_HOTEND", hotend_plant));
+  #if HAS_HEATED_BED
+    static const ThermalPlant bed_plant = { 250.0, 400.0, 1.6, 0.0, 0.0, 0.5, 25.0 };
+    Heater bed(HEATER_BED_PIN, TEMP_BED_PIN, TEMPTABLE_BED, TEMPTABLE_BED_LEN, load_plant("MARLIN_SIM_BED", bed_plant));
+  #endif
   LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
+  #if PIN_EXISTS(FAN0)
+    hotend.attach_fan(FAN0_PIN);
+  #endif
+  hotend.attach_extruder(&extruder0, steps_per_unit[E_AXIS]);
+
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
     Gpio::attachLogger(&logger);
@@ -82,7 +103,7 @@ void simulation_loop() {
   for (;;) {
 
     hotend.update();
-    bed.update();
+    TERN_(HAS_HEATED_BED, bed.update());
 
     x_axis.update();
     y_axis.update();
@@ -117,7 +138,9 @@ int main() {
   #endif
 
   Clock::setFrequency(F_CPU);
-  Clock::setTimeMultiplier(1.0); // some testing at 10x
+  // MARLIN_SIM_SPEED runs the simulation faster, e.g., for heater tuning against a fitted model
+  const char * const speed = getenv("MARLIN_SIM_SPEED");
+  Clock::setTimeMultiplier(speed ? atof(speed) : 1.0);
 
   HAL_timer_init();
 
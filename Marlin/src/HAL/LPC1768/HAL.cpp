@@ -40,6 +40,29 @@ DefaultSerial1 USBSerial(false, UsbSerial);
 uint32_t MarlinHAL::adc_result = 0;
 pin_t MarlinHAL::adc_pin = 0;
 
+#if ENABLED(ADC_SCAN_SAMPLING)
+
+  /**
+   * The ADC already runs in burst mode, converting every enabled channel in
+   * turn into its own data register with no CPU involvement. A scan is just a
+   * pass over the channels, filtering the ones with a fresh conversion.
+   */
+  static pin_t adc_scan_pin[HAL_ADC_SCAN_MAX];
+  static uint16_t adc_scan_result[HAL_ADC_SCAN_MAX];
+
+  void MarlinHAL::adc_scan_init(const pin_t pins[], const uint8_t count) {
+    for (uint8_t i = 0; i < _MIN(count, HAL_ADC_SCAN_MAX); ++i) adc_scan_pin[i] = pins[i];
+  }
+
+  uint16_t MarlinHAL::adc_scan_value(const uint8_t index) {
+    const pin_t pin = adc_scan_pin[index];
+    if (LPC176x::adc_hardware.done(LPC176x::pin_get_adc_channel(pin)))
+      adc_scan_result[index] = FilteredADC::read(pin) >> (16 - HAL_ADC_RESOLUTION); // returns 16bit value, reduce to required bits
+    return adc_scan_result[index];
+  }
+
+#endif
+
 // U8glib required functions
 extern "C" {
   void u8g_xMicroDelay(uint16_t val) { DELAY_US(val); }
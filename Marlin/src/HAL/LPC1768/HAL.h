@@ -131,6 +131,7 @@ extern DefaultSerial1 USBSerial;
 
 #define HAL_ADC_RESOLUTION     12   // 15 bit maximum, raw temperature is stored as int16_t
 #define HAL_ADC_FILTERED            // Disable oversampling done in Marlin as ADC values already filtered in HAL
+#define HAL_ADC_SCAN_MAX        8   // ADC_SCAN_SAMPLING channels (AD0.0 - AD0.7)
 
 //
 // Pin Mapping for M42, M43, M226
@@ -256,6 +257,14 @@ public:
     return uint16_t(adc_result);
   }
 
+  #if ENABLED(ADC_SCAN_SAMPLING)
+    // Called by Temperature::init once with the pins to read as a batch
+    static void adc_scan_init(const pin_t pins[], const uint8_t count);
+
+    // The latest filtered conversion of the pin in the given scan slot
+    static uint16_t adc_scan_value(const uint8_t index);
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * Optionally invert the duty cycle [default = false]
@@ -59,6 +59,8 @@ enum XPTCoordinate : uint8_t {
 #endif
 
 class XPT2046 {
+  friend class TouchSampler;
+
 private:
   static bool isBusy() { return false; }
 
@@ -162,6 +162,220 @@ void MarlinHAL::clear_reset_source() { __HAL_RCC_CLEAR_RESET_FLAGS(); }
 
 #endif
 
+// ------------------------
+// ADC Scan Sampling
+// ------------------------
+
+#if ENABLED(ADC_SCAN_SAMPLING)
+
+  /**
+   * ADC1 converts the whole regular sequence over and over, with DMA in circular
+   * mode writing each result to its slot in the buffer. Nothing is left for the
+   * CPU to do but read the latest values. The STM32G0 oversamples in hardware.
+   * Elsewhere the buffer holds several whole scans and the reader averages them.
+   * Pins that ADC1 can't reach take turns on their own ADC, one conversion
+   * started per call and collected on a later one, so the ISR never waits.
+   */
+  #ifdef STM32G0xx
+    #define ADC_SCAN_PASSES 1
+  #else
+    #define ADC_SCAN_PASSES ADC_SCAN_OVERSAMPLE
+  #endif
+
+  static ADC_HandleTypeDef adc_scan_handle;
+  static DMA_HandleTypeDef adc_scan_dma;
+  static volatile uint16_t adc_scan_buffer[HAL_ADC_SCAN_MAX * (ADC_SCAN_PASSES)];
+  static pin_t adc_scan_pin[HAL_ADC_SCAN_MAX];
+  static int8_t adc_scan_rank[HAL_ADC_SCAN_MAX];    // Position in the sequence, -1 if not on ADC1
+  static uint8_t adc_scan_count, adc_scan_ranks;
+
+  #ifndef STM32G0xx
+    static ADC_HandleTypeDef adc_other_handle;            // Single conversions for pins not on ADC1
+    static uint16_t adc_other_value[HAL_ADC_SCAN_MAX];    // Last result for each of those slots
+    static int8_t adc_other_busy = -1;                    // Slot being converted, -1 if idle
+
+    // Start a conversion of the slot's pin on its own ADC without waiting for it
+    static void adc_other_start(const uint8_t index) {
+      ADC_HandleTypeDef &hadc = adc_other_handle;
+      const PinName pn = digitalPinToPinName(adc_scan_pin[index]);
+      ADC_TypeDef * const adc = (ADC_TypeDef*)pinmap_peripheral(pn, PinMap_ADC);
+      if (!adc) return;
+      // Set up from scratch each time. analogRead may have released this ADC since.
+      hadc.Instance = adc;
+      hadc.State = HAL_ADC_STATE_RESET;                   // MspInit enables the ADC clock
+      hadc.Init.ScanConvMode          = TERN(STM32F4xx, DISABLE, ADC_SCAN_DISABLE);
+      hadc.Init.ContinuousConvMode    = DISABLE;
+      hadc.Init.DiscontinuousConvMode = DISABLE;
+      hadc.Init.ExternalTrigConv      = ADC_SOFTWARE_START;
+      hadc.Init.DataAlign             = ADC_DATAALIGN_RIGHT;
+      hadc.Init.NbrOfConversion       = 1;
+      #ifdef STM32F4xx
+        hadc.Init.ClockPrescaler        = ADC_CLOCK_SYNC_PCLK_DIV4;
+        hadc.Init.Resolution            = ADC_RESOLUTION_12B;
+        hadc.Init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_NONE;
+        hadc.Init.DMAContinuousRequests = DISABLE;
+        hadc.Init.EOCSelection          = ADC_EOC_SINGLE_CONV;
+      #endif
+      if (HAL_ADC_Init(&hadc) != HAL_OK) return;
+      ADC_ChannelConfTypeDef sConfig = {};
+      sConfig.Channel = STM_PIN_CHANNEL(pinmap_function(pn, PinMap_ADC));
+      sConfig.Rank = 1;
+      sConfig.SamplingTime = TERN(STM32F1xx, ADC_SAMPLETIME_71CYCLES_5, ADC_SAMPLETIME_84CYCLES);
+      if (HAL_ADC_ConfigChannel(&hadc, &sConfig) != HAL_OK) return;
+      if (HAL_ADC_Start(&hadc) == HAL_OK) adc_other_busy = index;
+    }
+
+    // Collect the slot's finished conversion, or start one if the ADC is free
+    static void adc_other_poll(const uint8_t index) {
+      ADC_HandleTypeDef &hadc = adc_other_handle;
+      if (adc_other_busy >= 0) {
+        if (adc_other_busy != index || !__HAL_ADC_GET_FLAG(&hadc, ADC_FLAG_EOC)) return;
+        adc_other_value[index] = HAL_ADC_GetValue(&hadc);
+        HAL_ADC_Stop(&hadc);
+        adc_other_busy = -1;                              // Let the next pin have a turn
+        return;
+      }
+      adc_other_start(index);
+    }
+  #endif
+
+  void MarlinHAL::adc_scan_init(const pin_t pins[], const uint8_t count) {
+    #ifdef STM32G0xx
+      static const uint32_t rank_id[] = {
+        ADC_REGULAR_RANK_1, ADC_REGULAR_RANK_2, ADC_REGULAR_RANK_3, ADC_REGULAR_RANK_4,
+        ADC_REGULAR_RANK_5, ADC_REGULAR_RANK_6, ADC_REGULAR_RANK_7, ADC_REGULAR_RANK_8
+      };
+    #endif
+
+    ADC_HandleTypeDef &hadc = adc_scan_handle;
+    hadc.Instance = ADC1;
+
+    adc_scan_count = _MIN(count, HAL_ADC_SCAN_MAX);
+    adc_scan_ranks = 0;
+    for (uint8_t i = 0; i < adc_scan_count; ++i) {
+      const PinName pn = digitalPinToPinName(pins[i]);
+      adc_scan_pin[i] = pins[i];
+      adc_scan_rank[i] = -1;
+      const void * const adc = pinmap_peripheral(pn, PinMap_ADC);
+      if (!adc) continue;
+      pinmap_pinout(pn, PinMap_ADC);
+      if (adc == ADC1) adc_scan_rank[i] = adc_scan_ranks++;
+    }
+    if (!adc_scan_ranks) return;
+
+    // Regular sequence converted continuously, triggered once by software
+    hadc.Init.ScanConvMode          = TERN(STM32F4xx, ENABLE, ADC_SCAN_ENABLE);
+    hadc.Init.ContinuousConvMode    = ENABLE;
+    hadc.Init.DiscontinuousConvMode = DISABLE;
+    hadc.Init.ExternalTrigConv      = ADC_SOFTWARE_START;
+    hadc.Init.DataAlign             = ADC_DATAALIGN_RIGHT;
+    hadc.Init.NbrOfConversion       = adc_scan_ranks;
+    #ifndef STM32F1xx
+      hadc.Init.ClockPrescaler          = ADC_CLOCK_SYNC_PCLK_DIV4;
+      hadc.Init.Resolution              = ADC_RESOLUTION_12B;
+      hadc.Init.ExternalTrigConvEdge    = ADC_EXTERNALTRIGCONVEDGE_NONE;
+      hadc.Init.DMAContinuousRequests   = ENABLE;
+      hadc.Init.EOCSelection            = ADC_EOC_SEQ_CONV;
+    #endif
+    #ifdef STM32G0xx
+      constexpr uint32_t ovs_bits = __builtin_ctz(ADC_SCAN_OVERSAMPLE);
+      hadc.Init.Overrun                 = ADC_OVR_DATA_OVERWRITTEN;
+      hadc.Init.LowPowerAutoWait        = DISABLE;
+      hadc.Init.LowPowerAutoPowerOff    = DISABLE;
+      hadc.Init.SamplingTimeCommon1     = ADC_SAMPLETIME_79CYCLES_5;
+      hadc.Init.TriggerFrequencyMode    = ADC_TRIGGER_FREQ_HIGH;
+      hadc.Init.OversamplingMode        = ENABLE;
+      hadc.Init.Oversampling.Ratio         = (ovs_bits - 1) << ADC_CFGR2_OVSR_Pos; // ADC_OVERSAMPLING_RATIO_n
+      hadc.Init.Oversampling.RightBitShift = ovs_bits << ADC_CFGR2_OVSS_Pos;       // ADC_RIGHTBITSHIFT_n
+      hadc.Init.Oversampling.TriggeredMode = ADC_TRIGGEREDMODE_SINGLE_TRIGGER;
+    #endif
+
+    // Circular DMA from the data register into the buffer
+    DMA_HandleTypeDef &hdma = adc_scan_dma;
+    #ifdef STM32F4xx
+      __HAL_RCC_DMA2_CLK_ENABLE();
+      #if ADC_SCAN_DMA_STREAM == 4
+        hdma.Instance = DMA2_Stream4;
+      #else
+        hdma.Instance = DMA2_Stream0;
+      #endif
+      hdma.Init.Channel = DMA_CHANNEL_0;
+      hdma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    #else
+      __HAL_RCC_DMA1_CLK_ENABLE();
+      hdma.Instance = DMA1_Channel1;
+      TERN_(STM32G0xx, hdma.Init.Request = DMA_REQUEST_ADC1);
+    #endif
+    hdma.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma.Init.MemInc = DMA_MINC_ENABLE;
+    hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    hdma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    hdma.Init.Mode = DMA_CIRCULAR;
+    hdma.Init.Priority = DMA_PRIORITY_LOW;
+    if (HAL_DMA_Init(&hdma) != HAL_OK) return;
+    __HAL_LINKDMA(&hadc, DMA_Handle, hdma);
+
+    if (HAL_ADC_Init(&hadc) != HAL_OK) return;
+
+    ADC_ChannelConfTypeDef sConfig = {};
+    for (uint8_t i = 0; i < adc_scan_count; ++i) {
+      if (adc_scan_rank[i] < 0) continue;
+      const PinName pn = digitalPinToPinName(adc_scan_pin[i]);
+      const uint32_t ch = STM_PIN_CHANNEL(pinmap_function(pn, PinMap_ADC));
+      #ifdef STM32G0xx
+        sConfig.Channel = __LL_ADC_DECIMAL_NB_TO_CHANNEL(ch);
+        sConfig.Rank = rank_id[adc_scan_rank[i]];
+        sConfig.SamplingTime = ADC_SAMPLINGTIME_COMMON_1;
+      #else
+        sConfig.Channel = ch;
+        sConfig.Rank = adc_scan_rank[i] + 1;
+        sConfig.SamplingTime = TERN(STM32F1xx, ADC_SAMPLETIME_71CYCLES_5, ADC_SAMPLETIME_84CYCLES);
+      #endif
+      if (HAL_ADC_ConfigChannel(&hadc, &sConfig) != HAL_OK) return;
+    }
+
+    #ifndef STM32F4xx
+      HAL_ADCEx_Calibration_Start(&hadc);
+    #endif
+
+    // The DMA interrupts stay disabled in the NVIC. No callbacks are needed.
+    HAL_ADC_Start_DMA(&hadc, (uint32_t*)adc_scan_buffer, adc_scan_ranks * (ADC_SCAN_PASSES));
+  }
+
+  uint16_t MarlinHAL::adc_scan_value(const uint8_t index) {
+    const int8_t rank = adc_scan_rank[index];
+    if (rank < 0) {
+      #ifdef STM32G0xx
+        return 0;                                         // Only ADC1 exists
+      #else
+        adc_other_poll(index);
+        return adc_other_value[index] >> (12 - HAL_ADC_RESOLUTION);
+      #endif
+    }
+    uint32_t sum = 0;
+    for (uint8_t p = 0; p < ADC_SCAN_PASSES; ++p)
+      sum += adc_scan_buffer[p * adc_scan_ranks + rank];
+    return uint16_t(sum / (ADC_SCAN_PASSES)) >> (12 - HAL_ADC_RESOLUTION); // shift out unused bits
+  }
+
+  uint16_t MarlinHAL::adc_scan_read(const pin_t pin) {
+    for (uint8_t i = 0; i < adc_scan_count; ++i)
+      if (adc_scan_pin[i] == pin) return adc_scan_value(i);
+
+    // Resolve the pin the way analogRead would (M43 passes analog numbers)
+    const PinName pn = analogInputToPinName(pin);
+    for (uint8_t i = 0; i < adc_scan_count; ++i)
+      if (digitalPinToPinName(adc_scan_pin[i]) == pn) return adc_scan_value(i);
+
+    // A direct read would reconfigure ADC1 and stop the scan, so refuse it
+    if (adc_scan_ranks && pinmap_peripheral(pn, PinMap_ADC) == ADC1) return 0;
+
+    return (analogRead)(pin); // The core function, not the redirect in HAL.h
+  }
+
+#endif // ADC_SCAN_SAMPLING
+
 extern "C" {
   extern unsigned int _ebss; // end of bss section
 }
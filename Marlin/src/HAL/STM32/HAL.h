@@ -112,7 +112,7 @@
   #else
     #error "LCD_SERIAL_PORT must be from 1 to 9, or -1 for Native USB."
   #endif
-  #if ANY(HAS_DGUS_LCD, EXTENSIBLE_UI)
+  #if ANY(HAS_DGUS_LCD, EXTENSIBLE_UI, DWIN_TX_QUEUE)
     #define LCD_SERIAL_TX_BUFFER_FREE() LCD_SERIAL.availableForWrite()
   #endif
 #endif
@@ -165,6 +165,17 @@ typedef libServo hal_servo_t;
 
 #define HAL_ADC_VREF_MV   3300
 
+#ifdef STM32G0xx
+  #define HAL_ADC_SCAN_MAX  8   // Regular sequence length for ADC_SCAN_SAMPLING
+#else
+  #define HAL_ADC_SCAN_MAX 16
+#endif
+
+// ADC1 is served by DMA2 Stream 0 or 4 on STM32F4. Stream 0 is also used by the FSMC TFT and SPI flash RX.
+#if defined(STM32F4xx) && !defined(ADC_SCAN_DMA_STREAM)
+  #define ADC_SCAN_DMA_STREAM 4
+#endif
+
 //
 // Pin Mapping for M42, M43, M226
 //
@@ -263,7 +274,7 @@ public:
   static void adc_enable(const pin_t pin) { pinMode(pin, INPUT); }
 
   // Begin ADC sampling on the given pin. Called from Temperature::isr!
-  static void adc_start(const pin_t pin) { adc_result = analogRead(pin); }
+  static void adc_start(const pin_t pin) { adc_result = TERN(ADC_SCAN_SAMPLING, adc_scan_read(pin), analogRead(pin)); }
 
   // Is the ADC ready for reading?
   static bool adc_ready() { return true; }
@@ -271,6 +282,19 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value() { return adc_result; }
 
+  #if ENABLED(ADC_SCAN_SAMPLING)
+
+    // Called by Temperature::init once to convert the given pins continuously
+    static void adc_scan_init(const pin_t pins[], const uint8_t count);
+
+    // The latest (averaged) conversion of the pin in the given scan slot
+    static uint16_t adc_scan_value(const uint8_t index);
+
+    // The latest conversion of a scanned pin, or a direct reading for other pins
+    static uint16_t adc_scan_read(const pin_t pin);
+
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * Optionally invert the duty cycle [default = false]
@@ -285,3 +309,8 @@ public:
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
 
 };
+
+#if ENABLED(ADC_SCAN_SAMPLING)
+  // Serve direct reads (M43, PINS_DEBUGGING) from the scan so they can't stop it
+  #define analogRead(P) MarlinHAL::adc_scan_read(P)
+#endif
@@ -262,6 +262,10 @@ void HAL_HardwareSerial::init(PinName _rx, PinName _tx) {
   _serial.pin_tx  = _tx;
   _serial.tx_buff = _tx_buffer;
   _serial.tx_head = _serial.tx_tail = 0;
+
+  _rx_overruns = 0;
+  _rx_max_enqueued = 0;
+  TERN_(SERIAL_DMA_LINE_SCAN, _rx_scan = 0);
 }
 
 // Actual interrupt handlers //////////////////////////////////////////////////////////////
@@ -340,6 +344,8 @@ void HAL_HardwareSerial::update_rx_head() {
     }
   #endif
 
+  const rx_buffer_index_t was_enqueued = (RX_BUFFER_SIZE + _serial.rx_head - _serial.rx_tail) % RX_BUFFER_SIZE;
+
   #if ANY(STM32F2xx, STM32F4xx, STM32F7xx)
     _serial.rx_head = RX_BUFFER_SIZE - RX_DMA.dma_streamRX->NDTR;
   #endif
@@ -348,6 +354,10 @@ void HAL_HardwareSerial::update_rx_head() {
     _serial.rx_head = RX_BUFFER_SIZE - RX_DMA.dma_channelRX->CNDTR;
   #endif
 
+  // Only read() moves the tail, so a shrinking queue means the DMA lapped it
+  const rx_buffer_index_t enqueued = (RX_BUFFER_SIZE + _serial.rx_head - _serial.rx_tail) % RX_BUFFER_SIZE;
+  if (enqueued < was_enqueued && !++_rx_overruns) --_rx_overruns;
+  NOLESS(_rx_max_enqueued, enqueued);
 }
 
 int HAL_HardwareSerial::available() {
@@ -370,6 +380,54 @@ int HAL_HardwareSerial::read() {
   return c;
 }
 
+#if ENABLED(SERIAL_DMA_LINE_SCAN)
+
+  /**
+   * Copy one complete line straight out of the DMA ring buffer.
+   * The scan resumes where the previous call stopped, so each byte
+   * is only examined once no matter how often this is polled.
+   *
+   * Return the line length (without the EOL, which is consumed),
+   * -2 if no complete line has arrived yet, or -1 if the line won't
+   * fit in 'size' bytes (or the ring) so the caller should use read().
+   */
+  int HAL_HardwareSerial::readLine(char *buff, const int size) {
+    update_rx_head();
+
+    const rx_buffer_index_t head = _serial.rx_head, tail = _serial.rx_tail,
+                            enqueued = (RX_BUFFER_SIZE + head - tail) % RX_BUFFER_SIZE;
+
+    // read() may have consumed bytes past the last scan position
+    if ((RX_BUFFER_SIZE + _rx_scan - tail) % RX_BUFFER_SIZE > enqueued) _rx_scan = tail;
+
+    rx_buffer_index_t i = _rx_scan;
+    while (i != head && !ISEOL(_serial.rx_buff[i])) i = (i + 1) % RX_BUFFER_SIZE;
+    _rx_scan = i;
+
+    const int len = (RX_BUFFER_SIZE + i - tail) % RX_BUFFER_SIZE;
+    if (i == head) {
+      // Lines longer than the ring can only be taken a byte at a time
+      if (len >= size || enqueued >= RX_BUFFER_SIZE - 1) return -1;
+      return -2;                            // Wait for the rest of the line
+    }
+    if (len >= size) return -1;             // Too long for the caller's buffer
+
+    // Copy the line in (at most) two contiguous runs
+    if (i >= tail)
+      memcpy(buff, &_serial.rx_buff[tail], len);
+    else {
+      const int run = RX_BUFFER_SIZE - tail;
+      memcpy(buff, &_serial.rx_buff[tail], run);
+      memcpy(buff + run, _serial.rx_buff, i);
+    }
+    buff[len] = '\0';
+
+    _serial.rx_tail = _rx_scan = (i + 1) % RX_BUFFER_SIZE;
+    return len;
+  }
+
+#endif // SERIAL_DMA_LINE_SCAN
+
 size_t HAL_HardwareSerial::write(uint8_t c) {             // Interrupt based writing
   tx_buffer_index_t i = (_serial.tx_head + 1) % TX_BUFFER_SIZE;
 
@@ -68,6 +68,16 @@ class HAL_HardwareSerial : public Stream {
     virtual void flush();
     operator bool() { return true; }
 
+    #if ENABLED(SERIAL_DMA_LINE_SCAN)
+      int readLine(char *buff, const int size);
+    #endif
+
+    // Receive statistics, updated as the DMA head is polled and cleared as they are taken
+    void takeRxStats(uint16_t * const max_enqueued, uint8_t * const overruns) {
+      *max_enqueued = _rx_max_enqueued; *overruns = _rx_overruns;
+      _rx_max_enqueued = _rx_overruns = 0;
+    }
+
     void setRx(uint32_t _rx);
     void setTx(uint32_t _tx);
 
@@ -78,6 +88,11 @@ class HAL_HardwareSerial : public Stream {
     bool    _rx_enabled;
     uint8_t _config;
     unsigned long _baud;
+    uint8_t _rx_overruns;
+    rx_buffer_index_t _rx_max_enqueued;
+    #if ENABLED(SERIAL_DMA_LINE_SCAN)
+      rx_buffer_index_t _rx_scan;   // Position where the last EOL scan stopped
+    #endif
     void init(PinName _rx, PinName _tx);
     void update_rx_head();
     DMA_CFG RX_DMA;
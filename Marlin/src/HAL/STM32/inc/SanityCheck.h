@@ -54,6 +54,20 @@
   #error "TEMP_SENSOR_SOC requires 'TEMP_SOC_PIN ATEMP' on STM32."
 #endif
 
+#if ENABLED(ADC_SCAN_SAMPLING)
+  #if NONE(STM32F1xx, STM32F4xx, STM32G0xx)
+    #error "ADC_SCAN_SAMPLING is currently only supported on STM32F1, STM32F4 and STM32G0 hardware."
+  #elif TEMP_SENSOR_SOC
+    #error "ADC_SCAN_SAMPLING is not compatible with TEMP_SENSOR_SOC on STM32."
+  #elif defined(STM32F4xx) && ADC_SCAN_DMA_STREAM != 0 && ADC_SCAN_DMA_STREAM != 4
+    #error "ADC_SCAN_DMA_STREAM must be 0 or 4 (DMA2 streams serving ADC1 on STM32F4)."
+  #elif defined(STM32F4xx) && ADC_SCAN_DMA_STREAM == 0 && HAS_FSMC_TFT
+    #error "ADC_SCAN_SAMPLING on DMA2 Stream 0 collides with the FSMC TFT DMA. Use ADC_SCAN_DMA_STREAM 4."
+  #elif defined(STM32F4xx) && ADC_SCAN_DMA_STREAM == 0 && ENABLED(SPI_FLASH)
+    #error "ADC_SCAN_SAMPLING on DMA2 Stream 0 collides with the SPI_FLASH RX DMA. Use ADC_SCAN_DMA_STREAM 4."
+  #endif
+#endif
+
 /**
  * Check for common serial pin conflicts
  */
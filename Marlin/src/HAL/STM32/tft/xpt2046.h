@@ -65,6 +65,8 @@ enum XPTCoordinate : uint8_t {
 #endif
 
 class XPT2046 {
+  friend class TouchSampler;
+
 private:
   static SPI_HandleTypeDef SPIx;
 
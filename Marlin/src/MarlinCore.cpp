@@ -66,6 +66,10 @@
   #include "lcd/touch/touch_buttons.h"
 #endif
 
+#if ENABLED(DWIN_TX_QUEUE)
+  #include "lcd/e3v2/common/dwin_api.h"
+#endif
+
 #if HAS_TFT_LVGL_UI
   #include "lcd/extui/mks_ui/tft_lvgl_configuration.h"
   #include "lcd/extui/mks_ui/draw_ui.h"
@@ -814,6 +818,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(HAS_MEDIA, card.manage_media());
 
+  // Write pending power-loss checkpoints
+  TERN_(POWER_LOSS_JOURNAL, recovery.journal_task());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
@@ -833,6 +840,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
     ui.update();
   #endif
 
+  // Pass queued drawing commands to the display
+  TERN_(DWIN_TX_QUEUE, dwinService());
+
   // Run i2c Position Encoders
   #if ENABLED(I2C_POSITION_ENCODERS)
   {
@@ -902,6 +912,7 @@ void kill(FSTR_P const lcd_error/*=nullptr*/, FSTR_P const lcd_component/*=nullp
 
   #if HAS_DISPLAY
     ui.kill_screen(lcd_error ?: GET_TEXT_F(MSG_KILLED), lcd_component ?: FPSTR(NUL_STR));
+    TERN_(DWIN_TX_QUEUE, dwinFlush()); // Send the kill screen before interrupts are stopped
   #else
     UNUSED(lcd_error); UNUSED(lcd_component);
   #endif
@@ -71,6 +71,9 @@ ENUM_FLAGS(SerialFeature);
 CALL_IF_EXISTS_IMPL(void, flushTX);
 CALL_IF_EXISTS_IMPL(bool, connected, true);
 CALL_IF_EXISTS_IMPL(SerialFeature, features, SerialFeature::None);
+// Only some DMA serial drivers can hand over whole lines. Return -1 to fall back to read().
+CALL_IF_EXISTS_IMPL(int, readLine, -1);
+CALL_IF_EXISTS_IMPL(void, takeRxStats);
 
 // A simple forward struct to prevent the compiler from selecting print(double, int) as a default overload
 // for any type other than double/float. For double/float, a conversion exists so the call will be invisible.
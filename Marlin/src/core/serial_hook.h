@@ -64,6 +64,8 @@ struct BaseSerial : public SerialBase< BaseSerial<SerialT> >, public SerialT {
   // We don't care about indices here, since if one can call us, it's the right index anyway
   int available(serial_index_t) { return (int)SerialT::available(); }
   int read(serial_index_t)      { return (int)SerialT::read(); }
+  int readLine(serial_index_t, char *buff, const int size) { return CALL_IF_EXISTS(int, static_cast<SerialT*>(this), readLine, buff, size); }
+  void takeRxStats(serial_index_t, uint16_t * const m, uint8_t * const o) { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), takeRxStats, m, o); }
   bool connected()              { return CALL_IF_EXISTS(bool, static_cast<SerialT*>(this), connected);; }
   void flushTX()                { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), flushTX); }
 
@@ -104,6 +106,8 @@ struct ConditionalSerial : public SerialBase< ConditionalSerial<SerialT> > {
 
   int available(serial_index_t)   { return (int)out.available(); }
   int read(serial_index_t)        { return (int)out.read(); }
+  int readLine(serial_index_t, char *buff, const int size) { return CALL_IF_EXISTS(int, &out, readLine, buff, size); }
+  void takeRxStats(serial_index_t, uint16_t * const m, uint8_t * const o) { CALL_IF_EXISTS(void, &out, takeRxStats, m, o); }
   int available()                 { return (int)out.available(); }
   int read()                      { return (int)out.read(); }
   SerialFeature features(serial_index_t index) const  { return CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
@@ -129,6 +133,8 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
 
   int available(serial_index_t) { return (int)out.available(); }
   int read(serial_index_t)      { return (int)out.read(); }
+  int readLine(serial_index_t, char *buff, const int size) { return CALL_IF_EXISTS(int, &out, readLine, buff, size); }
+  void takeRxStats(serial_index_t, uint16_t * const m, uint8_t * const o) { CALL_IF_EXISTS(void, &out, takeRxStats, m, o); }
   int available()               { return (int)out.available(); }
   int read()                    { return (int)out.read(); }
   SerialFeature features(serial_index_t index) const  { return CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
@@ -158,6 +164,8 @@ struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public Seria
 
   int available(serial_index_t)  { return (int)SerialT::available(); }
   int read(serial_index_t)       { return (int)SerialT::read(); }
+  int readLine(serial_index_t, char *buff, const int size) { return CALL_IF_EXISTS(int, static_cast<SerialT*>(this), readLine, buff, size); }
+  void takeRxStats(serial_index_t, uint16_t * const m, uint8_t * const o) { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), takeRxStats, m, o); }
   using SerialT::available;
   using SerialT::read;
   using SerialT::flush;
@@ -247,6 +255,19 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     #undef _S_READ
     return -1;
   }
+  int readLine(serial_index_t index, char *buff, const int size) {
+    uint8_t pos = offset;
+    #define _S_READLINE(N) if (index.within(pos, pos + step - 1)) return CALL_IF_EXISTS(int, &serial##N, readLine, index, buff, size); else pos += step;
+    REPEAT(NUM_SERIAL, _S_READLINE);
+    #undef _S_READLINE
+    return -1;
+  }
+  void takeRxStats(serial_index_t index, uint16_t * const m, uint8_t * const o) {
+    uint8_t pos = offset;
+    #define _S_RXSTATS(N) if (index.within(pos, pos + step - 1)) return CALL_IF_EXISTS(void, &serial##N, takeRxStats, index, m, o); else pos += step;
+    REPEAT(NUM_SERIAL, _S_RXSTATS);
+    #undef _S_RXSTATS
+  }
   void begin(const long br) {
     #define _S_BEGIN(N) if (portMask.enabled(output[N])) serial##N.begin(br);
     REPEAT(NUM_SERIAL, _S_BEGIN);
@@ -52,6 +52,15 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::ui_flag_resume; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  job_recovery_journal_block_t PrintJobRecovery::journal_block;
+  uint32_t PrintJobRecovery::journal_lba, // = 0
+           PrintJobRecovery::journal_seq; // = 0
+  uint8_t PrintJobRecovery::journal_sector, PrintJobRecovery::journal_slot;
+  bool PrintJobRecovery::journal_dirty, PrintJobRecovery::journal_failed;
+  millis_t PrintJobRecovery::journal_flush_ms, PrintJobRecovery::journal_next_ms;
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -74,6 +83,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -99,7 +112,13 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { memset(&info, 0, sizeof(info)); }
+void PrintJobRecovery::init() {
+  memset(&info, 0, sizeof(info));
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    journal_lba = 0;
+    journal_dirty = journal_failed = false;
+  #endif
+}
 
 /**
  * Enable or disable then call changed()
@@ -157,6 +176,11 @@ void PrintJobRecovery::load() {
     open(true);
     (void)file.read(&info, sizeof(info));
     close();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // Apply the newest checkpoint and continue the journal from there
+      journal_lba = journal_locate();
+      if (journal_lba) journal_scan(true);
+    #endif
   }
   debug(F("Load"));
 }
@@ -185,6 +209,26 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     #define POWER_LOSS_MIN_Z_CHANGE 0.05  // Vase-mode-friendly out of the box
   #endif
 
+  // Z at the last save. info.current_position is pre-filled by the Stepper ISR so it can't tell.
+  static float last_save_z; // = 0
+  const bool z_raised = current_position.z > last_save_z + POWER_LOSS_MIN_Z_CHANGE;
+  UNUSED(z_raised);
+
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    // Once a snapshot is saved, only checkpoint the changing state to the journal,
+    // unless state that only the snapshot holds has changed
+    const bool stale = journal_lba && journal_stale();
+    if (!force && journal_lba && !stale) {
+      const millis_t jms = millis();
+      if (ELAPSED(jms, journal_next_ms) || z_raised) {
+        journal_next_ms = jms + POWER_LOSS_JOURNAL_MS;
+        last_save_z = current_position.z;
+        journal_append();
+      }
+      return;
+    }
+  #endif
+
   // Did Z change since the last call?
   if (force
     #if DISABLED(SAVE_EACH_CMD_MODE)      // Always save state when enabled
@@ -192,13 +236,18 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
         || ELAPSED(ms, next_save_ms)
       #endif
       // Save if Z is above the last-saved position by some minimum height
-      || current_position.z > info.current_position.z + POWER_LOSS_MIN_Z_CHANGE
+      || z_raised
+    #endif
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      || !(journal_lba || journal_failed) // Save a snapshot to start the journal
+      || stale
     #endif
   ) {
 
     #if SAVE_INFO_INTERVAL_MS > 0
       next_save_ms = ms + SAVE_INFO_INTERVAL_MS;
     #endif
+    last_save_z = current_position.z;
 
     // Set Head and Foot to matching non-zero values
     if (!++info.valid_head) ++info.valid_head; // non-zero in sequence
@@ -358,6 +407,11 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    (void)journal_open();               // Set up the contiguous file on the first save
+    info.journal_seq = journal_seq;     // Older journal entries no longer apply
+  #endif
+
   open(false);
   file.seekSet(0);
   const int16_t ret = file.write(&info, sizeof(info));
@@ -365,6 +419,178 @@ void PrintJobRecovery::write() {
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  constexpr uint8_t PLR_SNAPSHOT_BLOCKS = (sizeof(job_recovery_info_t) + 511) / 512;
+  constexpr uint16_t PLR_FILE_BLOCKS = PLR_SNAPSHOT_BLOCKS + (POWER_LOSS_JOURNAL_SECTORS);
+
+  static uint16_t delta_crc(const job_recovery_delta_t &d) {
+    uint16_t crc = 0;
+    crc16(&crc, &d, offsetof(job_recovery_delta_t, crc));
+    return crc;
+  }
+
+  /**
+   * Get the first block of the journal in the recovery file, or 0 if the
+   * file isn't a contiguous file big enough to hold the journal.
+   */
+  uint32_t PrintJobRecovery::journal_locate() {
+    uint32_t bgn = 0, end = 0;
+    if (!exists()) return 0;
+    open(true);
+    const bool good = file.isOpen() && file.fileSize() >= PLR_FILE_BLOCKS * 512UL
+                   && file.contiguousRange(&bgn, &end) && end - bgn + 1 >= PLR_FILE_BLOCKS;
+    close();
+    return good ? bgn + PLR_SNAPSHOT_BLOCKS : 0;
+  }
+
+  /**
+   * Find the newest valid journal entry so new entries follow it.
+   * With 'apply' copy it into the info if it's newer than the snapshot.
+   */
+  void PrintJobRecovery::journal_scan(const bool apply) {
+    if (info.valid()) NOLESS(journal_seq, info.journal_seq);
+
+    job_recovery_delta_t newest;
+    uint8_t newest_sector = (POWER_LOSS_JOURNAL_SECTORS) - 1;
+    bool found = false;
+    for (uint8_t s = 0; s < (POWER_LOSS_JOURNAL_SECTORS); ++s) {
+      if (!card.diskIODriver()->readBlock(journal_lba + s, journal_block.data)) continue;
+      for (uint8_t i = 0; i < PLR_JOURNAL_SLOTS; ++i) {
+        const job_recovery_delta_t &d = journal_block.delta[i];
+        if (d.seq <= journal_seq || d.crc != delta_crc(d)) continue;
+        journal_seq = d.seq;
+        newest = d;
+        newest_sector = s;
+        found = true;
+      }
+    }
+
+    // Start a fresh sector after the newest one
+    memset(&journal_block, 0, sizeof(journal_block));
+    journal_sector = (newest_sector + 1) % (POWER_LOSS_JOURNAL_SECTORS);
+    journal_slot = 0;
+    journal_dirty = false;
+
+    if (apply && found && info.valid()) {
+      info.sdpos = newest.sdpos;
+      info.current_position = newest.current_position;
+      info.print_job_elapsed = newest.print_job_elapsed;
+      info.feedrate = newest.feedrate;
+      #if HAS_HOTEND
+        HOTEND_LOOP() info.target_temperature[e] = newest.target_temperature[e];
+      #endif
+      TERN_(HAS_HEATED_BED, info.target_temperature_bed = newest.target_temperature_bed);
+      TERN_(HAS_FAN, COPY(info.fan_speed, newest.fan_speed));
+      #if ENABLED(FWRETRACT)
+        COPY(info.retract, newest.retract);
+        info.retract_hop = newest.retract_hop;
+      #endif
+      DEBUG_ECHOLNPGM("Journal entry ", newest.seq, " applied.");
+    }
+  }
+
+  /**
+   * Make sure the recovery file is contiguous with room for the journal,
+   * creating it if needed. On failure saves go back to whole-file writes.
+   */
+  bool PrintJobRecovery::journal_open() {
+    if (journal_lba) return true;
+    if (journal_failed || !card.isMounted()) return false;
+
+    journal_lba = journal_locate();
+    if (journal_lba)
+      journal_scan(false);
+    else if (card.createJobRecoveryFile(PLR_FILE_BLOCKS * 512UL)) {
+      uint32_t bgn, end;
+      if (file.contiguousRange(&bgn, &end)) journal_lba = bgn + PLR_SNAPSHOT_BLOCKS;
+      close();
+
+      // Clear the ring so old card contents can't pass for entries
+      memset(&journal_block, 0, sizeof(journal_block));
+      for (uint8_t s = 0; journal_lba && s < (POWER_LOSS_JOURNAL_SECTORS); ++s)
+        if (!card.diskIODriver()->writeBlock(journal_lba + s, journal_block.data)) journal_lba = 0;
+
+      journal_sector = journal_slot = 0;
+      journal_dirty = false;
+    }
+
+    if (!journal_lba) {
+      journal_failed = true;
+      DEBUG_ECHOLNPGM("Power-loss journal unavailable.");
+    }
+    return !journal_failed;
+  }
+
+  /**
+   * Check for changes to state that journal entries don't hold,
+   * which need a new snapshot to be restored correctly.
+   */
+  bool PrintJobRecovery::journal_stale() {
+    return info.feedrate_percentage != feedrate_percentage
+      || memcmp(info.flow_percentage, planner.flow_percentage, sizeof(info.flow_percentage))
+      #if HAS_MULTI_EXTRUDER
+        || info.active_extruder != active_extruder
+      #endif
+      #if HAS_LEVELING
+        || info.flag.leveling != planner.leveling_active
+      #endif
+    ;
+  }
+
+  /**
+   * Add an entry to the sector buffer. It is written later by journal_task().
+   */
+  void PrintJobRecovery::journal_append() {
+    // Write out a full sector before starting on the next one
+    if (journal_slot >= PLR_JOURNAL_SLOTS) {
+      if (journal_dirty) journal_flush();
+      journal_sector = (journal_sector + 1) % (POWER_LOSS_JOURNAL_SECTORS);
+      journal_slot = 0;
+      memset(&journal_block, 0, sizeof(journal_block));
+    }
+
+    job_recovery_delta_t &d = journal_block.delta[journal_slot++];
+    d.seq = ++journal_seq;
+    d.sdpos = info.sdpos;                       // Kept current by the Stepper ISR
+    d.current_position = info.current_position;
+    d.print_job_elapsed = print_job_timer.duration();
+    d.feedrate = uint16_t(MMS_TO_MMM(feedrate_mm_s));
+    #if HAS_HOTEND
+      HOTEND_LOOP() d.target_temperature[e] = thermalManager.degTargetHotend(e);
+    #endif
+    TERN_(HAS_HEATED_BED, d.target_temperature_bed = thermalManager.degTargetBed());
+    TERN_(HAS_FAN, COPY(d.fan_speed, thermalManager.fan_speed));
+    #if ENABLED(FWRETRACT)
+      COPY(d.retract, fwretract.current_retract);
+      d.retract_hop = fwretract.current_hop;
+    #endif
+    d.crc = delta_crc(d);
+
+    if (!journal_dirty) {
+      journal_dirty = true;
+      journal_flush_ms = millis() + 1000UL;     // Don't hold an entry back for long
+    }
+  }
+
+  // Write the current journal sector straight to its block
+  void PrintJobRecovery::journal_flush() {
+    journal_dirty = false;
+    if (!card.isMounted() || !card.diskIODriver()->writeBlock(journal_lba + journal_sector, journal_block.data))
+      DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+  }
+
+  /**
+   * Called from idle() to write pending entries when the planner has moves
+   * in reserve to cover the card's write time, or when the entry is overdue.
+   */
+  void PrintJobRecovery::journal_task() {
+    if (journal_dirty && (planner.movesplanned() >= (BLOCK_BUFFER_SIZE) / 2 || ELAPSED(millis(), journal_flush_ms)))
+      journal_flush();
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
@@ -696,6 +922,9 @@ void PrintJobRecovery::resume() {
         DEBUG_ECHOLNPGM("sd_filename: ", info.sd_filename);
         DEBUG_ECHOLNPGM("sdpos: ", info.sdpos);
         DEBUG_ECHOLNPGM("print_job_elapsed: ", info.print_job_elapsed);
+        #if ENABLED(POWER_LOSS_JOURNAL)
+          DEBUG_ECHOLNPGM("journal_seq: ", info.journal_seq);
+        #endif
 
         DEBUG_ECHOPGM("axis_relative:");
         if (TEST(info.axis_relative, REL_X)) DEBUG_ECHOPGM(" REL_X");
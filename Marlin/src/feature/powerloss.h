@@ -120,6 +120,10 @@ typedef struct {
   // Job elapsed time
   millis_t print_job_elapsed;
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    uint32_t journal_seq;         // Journal entries after this one are newer than this snapshot
+  #endif
+
   // Relative axis modes
   relative_t axis_relative;
 
@@ -142,6 +146,43 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * A checkpoint of the state that changes during a print. These are
+   * kept in a ring of sectors following the job_recovery_info_t in the
+   * recovery file, and the newest valid one is applied on load.
+   */
+  typedef struct {
+    uint32_t seq;                 // Sequence number. Zero for an unused slot.
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    millis_t print_job_elapsed;
+    uint16_t feedrate;
+    #if HAS_HOTEND
+      celsius_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      celsius_t target_temperature_bed;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+    #if ENABLED(FWRETRACT)
+      float retract[EXTRUDERS], retract_hop;
+    #endif
+    uint16_t crc;                 // CRC16 of all preceding fields
+  } job_recovery_delta_t;
+
+  #define PLR_JOURNAL_SLOTS (512 / sizeof(job_recovery_delta_t))
+
+  typedef union {
+    uint8_t data[512];
+    job_recovery_delta_t delta[PLR_JOURNAL_SLOTS];
+  } job_recovery_journal_block_t;
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -200,6 +241,10 @@ class PrintJobRecovery {
     static void load();
     static void save(const bool force=ENABLED(SAVE_EACH_CMD_MODE), const float zraise=POWER_LOSS_ZRAISE, const bool raised=false);
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static void journal_task();
+    #endif
+
     #if PIN_EXISTS(POWER_LOSS)
       static void outage() {
         static constexpr uint8_t OUTAGE_THRESHOLD = 3;
@@ -227,6 +272,24 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static job_recovery_journal_block_t journal_block; //!< The journal sector being filled
+      static uint32_t journal_lba,    //!< First block of the journal ring. 0 if not opened.
+                      journal_seq;    //!< Sequence number of the newest entry
+      static uint8_t journal_sector,  //!< Ring index of the sector being filled
+                     journal_slot;    //!< Next free entry in that sector
+      static bool journal_dirty,      //!< The sector has entries not yet written
+                  journal_failed;     //!< No contiguous file could be made. Save the old way.
+      static millis_t journal_flush_ms, journal_next_ms;
+
+      static uint32_t journal_locate();
+      static void journal_scan(const bool apply);
+      static bool journal_open();
+      static void journal_append();
+      static void journal_flush();
+      static bool journal_stale();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
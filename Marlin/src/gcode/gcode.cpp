@@ -612,6 +612,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 123: M123(); break;                                  // M123: Report fan states or set fans auto-report interval
       #endif
 
+      #if ENABLED(AUTOTEMP_VOLUMETRIC)
+        case 124: M124(); break;                                  // M124: Set Autotemp flow curves
+      #endif
+
       #if HAS_HEATED_BED
         case 140: M140(); break;                                  // M140: Set bed temperature
         case 190: M190(); break;                                  // M190: Wait for bed temperature to reach target
@@ -819,6 +823,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 256: M256(); break;                                  // M256: Set LCD brightness
       #endif
 
+      #if HAS_DISPLAY_STATS
+        case 257: M257(); break;                                  // M257: Report display update statistics
+      #endif
+
       #if ENABLED(EXPERIMENTAL_I2CBUS)
         case 260: M260(); break;                                  // M260: Send data to an i2c slave
         case 261: M261(); break;                                  // M261: Request data from an i2c slave
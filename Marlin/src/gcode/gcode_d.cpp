@@ -280,12 +280,14 @@ void GcodeSuite::D(const int16_t dcode) {
        *   PD: Longest duration (ms) the planner buffer was empty (since the last report)
        *   BU: Command buffer underruns (since the last report)
        *   BD: Longest duration (ms) command buffer was empty (since the last report)
+       *   R : Peak serial RX queue size on this port (with SERIAL_DMA_LINE_SCAN, since the last report)
+       *   RO: Serial RX ring overruns on this port (with SERIAL_DMA_LINE_SCAN, since the last report)
        */
       case 576: {
         if (parser.seenval('S'))
           queue.set_auto_report_interval((uint8_t)parser.value_byte());
         else
-          queue.report_buffer_statistics();
+          queue.report_buffer_statistics(TERN_(SERIAL_DMA_LINE_SCAN, queue.ring_buffer.command_port()));
         break;
       }
 
@@ -0,0 +1,136 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_DISPLAY_STATS
+
+#include "../gcode.h"
+
+#if HAS_GRAPHICAL_TFT
+  #include "../../lcd/tft/tft.h"
+#endif
+#if ENABLED(UI_PLANNER_BUDGET)
+  #include "../../lcd/marlinui.h"
+  #include "../../module/planner.h"
+#endif
+#if ENABLED(UI_RENDER_STATS)
+  #include "../../lcd/marlinui.h"
+  #include "../../lcd/render_stats.h"
+  #include "../../libs/hex_print.h"
+  #if ENABLED(TOUCH_SCREEN)
+    #include "../../lcd/tft/touch.h"
+  #endif
+#endif
+#if ENABLED(EXTUI_DIFF_UPDATES)
+  #include "../../lcd/extui/var_cache.h"
+#endif
+#if ENABLED(DWIN_TX_QUEUE)
+  #include "../../lcd/e3v2/common/dwin_api.h"
+#endif
+
+/**
+ * M257: Report display update statistics
+ *
+ *  R   Reset the statistics
+ *
+ * With UI_RENDER_STATS, drive the menus for scripted benchmarks:
+ *  E<items>  Scroll the menu by this many items
+ *  C         Click the encoder button
+ *  H         Return to the Status Screen
+ *  X<x> Y<y> Tap the touch screen at this point, in pixels from 1 (Requires TOUCH_SCREEN)
+ */
+void GcodeSuite::M257() {
+  #if ENABLED(UI_RENDER_STATS)
+    if (parser.seen("ECH" TERN_(TOUCH_SCREEN, "XY"))) {
+      if (parser.seen_test('H')) ui.return_to_status();
+      if (parser.seenval('E')) ui.script_steps += parser.value_int();
+      if (parser.seen_test('C')) ui.script_click = true;
+      #if ENABLED(TOUCH_SCREEN)
+        if (parser.seenval('X') && parser.seenval('Y'))
+          touch.script_tap(parser.intval('X'), parser.intval('Y'));
+      #endif
+      return;
+    }
+  #endif
+
+  if (parser.seen_test('R')) {
+    TERN_(TFT_DOUBLE_BUFFER, tft.queue.stats = tft_queue_stats_t());
+    TERN_(UI_PLANNER_BUDGET, ui.budget_stats = ui_budget_stats_t());
+    TERN_(UI_RENDER_STATS, RenderStats::reset());
+    TERN_(EXTUI_DIFF_UPDATES, ExtUI::VarCache::stats = ExtUI::var_cache_stats_t());
+    #if ENABLED(DWIN_TX_QUEUE)
+      const uint16_t depth = dwinQueueStats.depth;
+      dwinQueueStats = dwin_queue_stats_t();
+      dwinQueueStats.depth = dwinQueueStats.peak = depth;
+    #endif
+    return;
+  }
+
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    const tft_queue_stats_t &stats = tft.queue.stats;
+    SERIAL_ECHOLNPGM("Frames:", stats.frames, " Last:", stats.frame_us, "us Max:", stats.max_frame_us, "us");
+    SERIAL_ECHOPGM("Sent:", stats.frame_bytes, " bytes");
+    if (stats.frame_us)
+      SERIAL_ECHOPGM(" (", uint32_t((uint64_t(stats.frame_bytes) * 1000000UL) / stats.frame_us), " bytes/s)");
+    SERIAL_EOL();
+  #endif
+
+  #if ENABLED(UI_PLANNER_BUDGET)
+    const ui_budget_stats_t &budget = ui.budget_stats;
+    SERIAL_ECHOLNPGM(
+      "UI updates:", budget.frames, " Deferred:", budget.deferred,
+      " Longest:", budget.max_defer_ms, "ms Queued moves:", planner.block_buffer_runtime(), "ms"
+    );
+  #endif
+
+  #if ENABLED(UI_RENDER_STATS)
+    // Complete the open frame only once it has all been drawn and sent. Until then report the one before.
+    if (!ui.drawing_screen && TERN1(HAS_GRAPHICAL_TFT, tft.queue.is_empty())) RenderStats::close();
+    const render_screen_stats_t &f = RenderStats::last;
+    SERIAL_ECHOPGM("Last frame:", hex_address((const void *)f.screen));
+    SERIAL_ECHOLNPGM(" Time:", f.total_us, "us Bytes:", f.bytes, " Full:", f.full, " Hash:", hex_word(f.hash));
+    for (uint8_t i = 0; i < RenderStats::count; ++i) {
+      const render_screen_stats_t &s = RenderStats::screens[i];
+      SERIAL_ECHOPGM("Screen ", hex_address((const void *)s.screen));
+      SERIAL_ECHOLNPGM(
+        " Frames:", s.frames, " Full:", s.full, " Avg:", s.total_us / s.frames, "us Max:", s.max_us,
+        "us Bytes:", s.bytes, " Hash:", hex_word(s.hash)
+      );
+    }
+  #endif
+
+  #if ENABLED(EXTUI_DIFF_UPDATES)
+    const ExtUI::var_cache_stats_t &vars = ExtUI::VarCache::stats;
+    SERIAL_ECHOLNPGM("Display values sent:", vars.sent, " Skipped:", vars.skipped, " Merged:", vars.batched);
+  #endif
+
+  #if ENABLED(DWIN_TX_QUEUE)
+    const dwin_queue_stats_t &dq = dwinQueueStats;
+    SERIAL_ECHOLNPGM(
+      "DWIN queue:", dq.depth, "/", DWIN_TX_QUEUE_SIZE, " bytes Peak:", dq.peak,
+      " Commands:", dq.commands, " Coalesced:", dq.coalesced, " Stalls:", dq.stalls
+    );
+  #endif
+}
+
+#endif // HAS_DISPLAY_STATS
@@ -74,6 +74,9 @@ GCodeQueue::RingBuffer GCodeQueue::ring_buffer = { 0 };
 
   uint8_t GCodeQueue::auto_buffer_report_interval;
   millis_t GCodeQueue::next_buffer_report_ms;
+  #if ENABLED(SERIAL_DMA_LINE_SCAN)
+    serial_index_t GCodeQueue::auto_buffer_report_port;
+  #endif
 #endif
 
 /**
@@ -299,6 +302,13 @@ static bool serial_data_available(serial_index_t index) {
 
 inline int read_serial(const serial_index_t index) { return SERIAL_IMPL.read(index); }
 
+#if ENABLED(SERIAL_DMA_LINE_SCAN)
+  // Copy a whole line from the serial driver, if it can (see HAL_HardwareSerial::readLine)
+  inline int read_serial_line(const serial_index_t index, char (&buff)[MAX_CMD_SIZE]) {
+    return SERIAL_IMPL.readLine(index, buff, MAX_CMD_SIZE);
+  }
+#endif
+
 #if (defined(ARDUINO_ARCH_STM32F4) || defined(ARDUINO_ARCH_STM32)) && defined(USBCON)
 
   /**
@@ -404,6 +414,93 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+/**
+ * Check a complete serial line for a valid line number and checksum,
+ * warn about moves while stopped, and handle critical commands early.
+ * Return true if the line should be added to the command queue.
+ */
+bool GCodeQueue::validate_serial_line(char * const line, const serial_index_t p) {
+  SerialState &serial = serial_state[p.index];
+  char *command = line;
+
+  while (*command == ' ') command++;                   // Skip leading spaces
+  char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
+
+  if (npos) {
+
+    const bool M110 = !!strstr_P(command, PSTR("M110"));
+
+    if (M110) {
+      char* n2pos = strchr(command + 4, 'N');
+      if (n2pos) npos = n2pos;
+    }
+
+    const long gcode_N = strtol(npos + 1, nullptr, 10);
+
+    // The line number must be in the correct sequence.
+    if (gcode_N != serial.last_N + 1 && !M110) {
+      // A request-for-resend line was already in transit so we got two - oops!
+      if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) return false;
+      // A corrupted line or too high, indicating a lost line
+      gcode_line_error(F(STR_ERR_LINE_NO), p);
+      return false;
+    }
+
+    char *apos = strrchr(command, '*');
+    if (apos) {
+      uint8_t checksum = 0, count = uint8_t(apos - command);
+      while (count) checksum ^= command[--count];
+      if (strtol(apos + 1, nullptr, 10) != checksum) {
+        gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+        return false;
+      }
+    }
+    else {
+      gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
+      return false;
+    }
+
+    serial.last_N = gcode_N;
+  }
+  #if HAS_MEDIA
+    // Pronterface "M29" and "M29 " has no line number
+    else if (card.flag.saving && !is_M29(command)) {
+      gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
+      return false;
+    }
+  #endif
+
+  //
+  // Movement commands give an alert when the machine is stopped
+  //
+
+  if (IsStopped()) {
+    char* gpos = strchr(command, 'G');
+    if (gpos) {
+      switch (strtol(gpos + 1, nullptr, 10)) {
+        case 0 ... 1:
+        TERN_(ARC_SUPPORT, case 2 ... 3:)
+        TERN_(BEZIER_CURVE_SUPPORT, case 5:)
+          PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
+          SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+          LCD_MESSAGE(MSG_STOPPED);
+          break;
+      }
+    }
+  }
+
+  #if DISABLED(EMERGENCY_PARSER)
+    // Process critical commands early
+    if (command[0] == 'M') switch (command[3]) {
+      case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_MARLINUI_MENU, wait_for_user = false); } break;
+      case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
+      case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
+    }
+  #endif
+
+  return true;
+}
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -444,6 +541,35 @@ void GCodeQueue::get_serial_commands() {
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
 
+      #if ENABLED(SERIAL_DMA_LINE_SCAN)
+        // At the start of a line try to take the whole line from the driver,
+        // copying it only once, straight into the next free command slot.
+        if (serial_state[p].count == 0 && serial_state[p].input_state == PS_NORMAL) {
+          CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+          const int len = read_serial_line(p, command.buffer);
+          if (len == -2) continue;              // Wait for the rest of the line
+          if (len >= 0) {
+            hadData = true;
+
+            // Strip comments in-place, just as the per-character path does
+            uint8_t sis = PS_NORMAL;
+            int ind = 0;
+            for (int i = 0; i < len; ++i) process_stream_char(command.buffer[i], sis, command.buffer, ind);
+            if (process_line_done(sis, command.buffer, ind)) continue;
+
+            if (!validate_serial_line(command.buffer, p)) continue;
+
+            #if NO_TIMEOUTS > 0
+              last_command_time = ms;
+            #endif
+
+            ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, p));
+            continue;
+          }
+          // Fall back to reading characters for an over-long line
+        }
+      #endif
+
       // Ok, we have some data to process, let's make progress here
       hadData = true;
 
@@ -467,82 +593,7 @@ void GCodeQueue::get_serial_commands() {
         if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
           continue;
 
-        char* command = serial.line_buffer;
-
-        while (*command == ' ') command++;                   // Skip leading spaces
-        char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
-
-        if (npos) {
-
-          const bool M110 = !!strstr_P(command, PSTR("M110"));
-
-          if (M110) {
-            char* n2pos = strchr(command + 4, 'N');
-            if (n2pos) npos = n2pos;
-          }
-
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
-
-          // The line number must be in the correct sequence.
-          if (gcode_N != serial.last_N + 1 && !M110) {
-            // A request-for-resend line was already in transit so we got two - oops!
-            if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
-            // A corrupted line or too high, indicating a lost line
-            gcode_line_error(F(STR_ERR_LINE_NO), p);
-            break;
-          }
-
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
-              gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
-              break;
-            }
-          }
-          else {
-            gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-
-          serial.last_N = gcode_N;
-        }
-        #if HAS_MEDIA
-          // Pronterface "M29" and "M29 " has no line number
-          else if (card.flag.saving && !is_M29(command)) {
-            gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-        #endif
-
-        //
-        // Movement commands give an alert when the machine is stopped
-        //
-
-        if (IsStopped()) {
-          char* gpos = strchr(command, 'G');
-          if (gpos) {
-            switch (strtol(gpos + 1, nullptr, 10)) {
-              case 0 ... 1:
-              TERN_(ARC_SUPPORT, case 2 ... 3:)
-              TERN_(BEZIER_CURVE_SUPPORT, case 5:)
-                PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
-                SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
-                LCD_MESSAGE(MSG_STOPPED);
-                break;
-            }
-          }
-        }
-
-        #if DISABLED(EMERGENCY_PARSER)
-          // Process critical commands early
-          if (command[0] == 'M') switch (command[3]) {
-            case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_MARLINUI_MENU, wait_for_user = false); } break;
-            case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
-            case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
-          }
-        #endif
+        if (!validate_serial_line(serial.line_buffer, p)) continue;
 
         #if NO_TIMEOUTS > 0
           last_command_time = ms;
@@ -707,11 +758,18 @@ void GCodeQueue::advance() {
 
 #if ENABLED(BUFFER_MONITORING)
 
-  void GCodeQueue::report_buffer_statistics() {
-    SERIAL_ECHOLNPGM("D576"
+  void GCodeQueue::report_buffer_statistics(TERN_(SERIAL_DMA_LINE_SCAN, const serial_index_t port)) {
+    SERIAL_ECHOPGM("D576"
       " P:", planner.moves_free(),         " ", planner_buffer_underruns, " (", max_planner_buffer_empty_duration, ")"
       " B:", BUFSIZE - ring_buffer.length, " ", command_buffer_underruns, " (", max_command_buffer_empty_duration, ")"
     );
+    #if ENABLED(SERIAL_DMA_LINE_SCAN)
+      uint16_t rx_max = 0;
+      uint8_t rx_overruns = 0;
+      SERIAL_IMPL.takeRxStats(port, &rx_max, &rx_overruns);
+      SERIAL_ECHOPGM(" R:", rx_max, " ", rx_overruns);
+    #endif
+    SERIAL_EOL();
     command_buffer_underruns = planner_buffer_underruns = 0;
     max_command_buffer_empty_duration = max_planner_buffer_empty_duration = 0;
   }
@@ -736,7 +794,7 @@ void GCodeQueue::advance() {
     if (auto_buffer_report_interval && ELAPSED(ms, next_buffer_report_ms)) {
       next_buffer_report_ms = ms + 1000UL * auto_buffer_report_interval;
       PORT_REDIRECT(SerialMask::All);
-      report_buffer_statistics();
+      report_buffer_statistics(TERN_(SERIAL_DMA_LINE_SCAN, auto_buffer_report_port));
       PORT_RESTORE();
     }
   }
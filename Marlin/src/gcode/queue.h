@@ -241,11 +241,16 @@ public:
      *  PD<uint>  Max time in ms the planner buffer was empty since last report
      *  BU<uint>  Number of command buffer underruns since last report
      *  BD<uint>  Max time in ms the command buffer was empty since last report
+     *  R<uint>   Peak serial RX queue size on 'port' since last report (SERIAL_DMA_LINE_SCAN)
+     *  RO<uint>  Number of serial RX ring overruns on 'port' since last report (SERIAL_DMA_LINE_SCAN)
      */
-    static void report_buffer_statistics();
+    static void report_buffer_statistics(TERN_(SERIAL_DMA_LINE_SCAN, const serial_index_t port));
 
     static uint8_t auto_buffer_report_interval;
     static millis_t next_buffer_report_ms;
+    #if ENABLED(SERIAL_DMA_LINE_SCAN)
+      static serial_index_t auto_buffer_report_port; // Port that set the interval, for RX statistics
+    #endif
 
     public:
 
@@ -255,6 +260,7 @@ public:
       NOMORE(v, 60);
       auto_buffer_report_interval = v;
       next_buffer_report_ms = millis() + 1000UL * v;
+      TERN_(SERIAL_DMA_LINE_SCAN, auto_buffer_report_port = ring_buffer.command_port());
     }
 
   #endif // BUFFER_MONITORING
@@ -275,6 +281,8 @@ private:
 
   static void gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind);
 
+  static bool validate_serial_line(char * const line, const serial_index_t serial_ind);
+
   friend class GcodeSuite;
 };
 
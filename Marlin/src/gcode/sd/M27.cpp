@@ -31,6 +31,7 @@
  * M27: Get SD Card status
  *      OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *      OR, with 'C' get the current filename.
+ *      OR, with 'R' get the measured media read rate. (Requires SD_STREAM_READS)
  */
 void GcodeSuite::M27() {
   if (parser.seen_test('C')) {
@@ -39,6 +40,13 @@ void GcodeSuite::M27() {
     return;
   }
 
+  #if ENABLED(SD_STREAM_READS)
+    if (parser.seen_test('R')) {
+      SERIAL_ECHOLNPGM("Media read: ", p_float_t(card.diskIODriver()->readRate() * 0.001f, 2), " MB/s");
+      return;
+    }
+  #endif
+
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     if (parser.seenval('S')) {
       card.auto_reporter.set_interval(parser.value_byte());
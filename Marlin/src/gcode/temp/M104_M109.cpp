@@ -59,9 +59,15 @@
  *  S<min>    : Minimum temperature, in current units.
  *  B<max>    : Maximum temperature, in current units.
  *
+ * With AUTOTEMP_VOLUMETRIC...
+ *  F<factor> : Scale for the flow curve selected with M124. F1 applies the curve as set.
+ *
  * M109 Parameters
  *  R<target> : The target temperature in current units. Wait for heating and cooling.
  *
+ * With HEATUP_AND_CONTINUE...
+ *  W         : Wait for heating right away. Otherwise wait before the next extruding move.
+ *
  * Examples
  *  M104 S100 : Set target to 100° and return.
  *  M109 R150 : Set target to 150°. Wait until the hotend gets close to 150°.
@@ -127,8 +133,13 @@ void GcodeSuite::M104_M109(const bool isM109) {
 
   TERN_(AUTOTEMP, planner.autotemp_M104_M109());
 
-  if (isM109 && got_temp)
+  if (isM109 && got_temp) {
+    #if ENABLED(HEATUP_AND_CONTINUE)
+      if (!parser.seen_test('W') && thermalManager.isHeatingHotend(target_extruder))
+        return thermalManager.defer_heatup(heater_id_t(target_extruder));
+    #endif
     (void)thermalManager.wait_for_hotend(target_extruder, no_wait_for_cooling);
+  }
 }
 
 #endif // HAS_HOTEND
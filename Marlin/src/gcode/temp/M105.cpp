@@ -25,9 +25,19 @@
 
 /**
  * M105: Read hot end and bed temperature
+ *
+ *  S - Report MAX thermocouple read times and SPI bus use (Requires MAX_TC_SCHEDULER)
  */
 void GcodeSuite::M105() {
 
+  #if ENABLED(MAX_TC_SCHEDULER)
+    if (parser.seen_test('S')) {
+      thermalManager.report_max_tc_bus();
+      SERIAL_ECHOLNPGM(STR_OK); // M105 sends its own 'ok'
+      return;
+    }
+  #endif
+
   const int8_t target_extruder = get_target_extruder_from_command();
   if (target_extruder < 0) return;
 
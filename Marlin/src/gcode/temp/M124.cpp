@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(AUTOTEMP_VOLUMETRIC)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * M124: Volumetric Autotemp flow curves
+ *
+ *  A<material>   Use this material's curve for Autotemp
+ *
+ * Set a curve point:
+ *  S<material>   Material index
+ *  P<point>      Point index, matching AUTOTEMP_FLOW_POINTS
+ *  C<celsius>    Degrees C to add to the Autotemp minimum at this point
+ *
+ * With no parameters, report the curves and the flow in the look-ahead window.
+ */
+void GcodeSuite::M124() {
+  if (parser.seenval('A')) {
+    const uint8_t m = parser.value_byte();
+    if (m < AUTOTEMP_MATERIALS)
+      planner.autotemp_material = m;
+    else
+      SERIAL_ECHOLNPGM("?(A) material index out of range (0-", int(AUTOTEMP_MATERIALS - 1), ").");
+  }
+
+  if (parser.seenval('S')) {
+    const uint8_t m = parser.value_byte(), p = parser.byteval('P');
+    if (m >= AUTOTEMP_MATERIALS)
+      SERIAL_ECHOLNPGM("?(S) material index out of range (0-", int(AUTOTEMP_MATERIALS - 1), ").");
+    else if (p >= AUTOTEMP_FLOW_COUNT)
+      SERIAL_ECHOLNPGM("?(P) point index out of range (0-", int(AUTOTEMP_FLOW_COUNT - 1), ").");
+    else if (parser.seenval('C'))
+      planner.autotemp_curve[m][p] = parser.value_int();
+  }
+
+  if (parser.seen("AS")) return;
+
+  M124_report(true);
+
+  const float flow = planner.autotemp_flow();
+  SERIAL_ECHOLNPGM("Flow ", p_float_t(flow, 2), " mm^3/s  Boost ", p_float_t(planner.autotemp_boost(flow), 1));
+}
+
+void GcodeSuite::M124_report(const bool forReplay/*=true*/) {
+  TERN_(MARLIN_SMALL_BUILD, return);
+
+  report_heading(forReplay, F("Autotemp flow curves"));
+  for (uint8_t m = 0; m < AUTOTEMP_MATERIALS; ++m)
+    for (uint8_t p = 0; p < AUTOTEMP_FLOW_COUNT; ++p) {
+      report_echo_start(forReplay);
+      SERIAL_ECHOLNPGM("  M124 S", m, " P", p, " C", planner.autotemp_curve[m][p]);
+    }
+  report_echo_start(forReplay);
+  SERIAL_ECHOLNPGM("  M124 A", planner.autotemp_material);
+}
+
+#endif // AUTOTEMP_VOLUMETRIC
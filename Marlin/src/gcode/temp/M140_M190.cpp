@@ -48,6 +48,9 @@
  * M190 Parameters
  *  R<target> : The target temperature in current units. Wait for heating and cooling.
  *
+ * With HEATUP_AND_CONTINUE:
+ *  W         : Wait for heating right away. Otherwise wait before the next extruding move.
+ *
  * Examples
  *  M140 S60 : Set target to 60° and return right away.
  *  M190 R40 : Set target to 40°. Wait until the bed gets close to 40°.
@@ -124,6 +127,11 @@ void GcodeSuite::M140_M190(const bool isM190) {
       }
     #endif
 
+    #if ENABLED(HEATUP_AND_CONTINUE)
+      if (!parser.seen_test('W') && thermalManager.isHeatingBed())
+        return thermalManager.defer_heatup(H_BED);
+    #endif
+
     thermalManager.wait_for_bed(no_wait_for_cooling);
   }
   else {
@@ -29,12 +29,20 @@
 
 /**
  * M155: Set temperature auto-report interval. M155 S<seconds>
+ *
+ * With THERMAL_TRACE:
+ *   L<bool> - Log the state of all heaters after every temperature update
  */
 void GcodeSuite::M155() {
 
   if (parser.seenval('S'))
     thermalManager.auto_reporter.set_interval(parser.value_byte());
 
+  #if ENABLED(THERMAL_TRACE)
+    if (parser.seen('L'))
+      thermalManager.thermal_trace = parser.value_bool();
+  #endif
+
 }
 
 #endif // AUTO_REPORT_TEMPERATURES
@@ -671,3 +671,8 @@
 #if ALL(SPI_FLASH, HAS_MEDIA, MARLIN_DEV_MODE)
   #define SPI_FLASH_BACKUP 1
 #endif
+
+// M257 display update statistics
+#if ANY(TFT_DOUBLE_BUFFER, UI_PLANNER_BUDGET, UI_RENDER_STATS, EXTUI_DIFF_UPDATES, DWIN_TX_QUEUE)
+  #define HAS_DISPLAY_STATS 1
+#endif
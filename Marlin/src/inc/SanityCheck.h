@@ -250,6 +250,9 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #elif !defined(HAL_UART_MODULE_ENABLED) || defined(HAL_UART_MODULE_ONLY)
     #error "SERIAL_DMA requires STM32 platform HAL UART (without HAL_UART_MODULE_ONLY)."
   #endif
+  #if ENABLED(SERIAL_DMA_LINE_SCAN) && DISABLED(HAL_STM32)
+    #error "SERIAL_DMA_LINE_SCAN is only available for STM32."
+  #endif
 #endif
 
 /**
@@ -413,6 +416,19 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+/**
+ * DOGM Dirty Pages
+ */
+#if ENABLED(DOGM_DIRTY_PAGES)
+  #if ENABLED(LIGHTWEIGHT_UI)
+    #error "DOGM_DIRTY_PAGES is not compatible with LIGHTWEIGHT_UI."
+  #elif ENABLED(TFT_CLASSIC_UI)
+    #error "DOGM_DIRTY_PAGES is not compatible with TFT_CLASSIC_UI."
+  #elif !defined(DOGM_FULL_REFRESH_SECONDS)
+    #error "DOGM_DIRTY_PAGES requires DOGM_FULL_REFRESH_SECONDS."
+  #endif
+#endif
+
 /**
  * SD Card Settings
  */
@@ -1013,6 +1029,71 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+#if ENABLED(MPC_FEEDFORWARD)
+  static_assert(MPC_FEEDFORWARD_TIME > 0, "MPC_FEEDFORWARD_TIME must be greater than 0.");
+#endif
+
+#if ENABLED(MPC_FAULT_DETECTION)
+  #if DISABLED(MPCTEMP)
+    #error "MPC_FAULT_DETECTION requires MPCTEMP."
+  #endif
+  static_assert(MPC_FAULT_DRIFT >= 0, "MPC_FAULT_DRIFT must be 0 or greater.");
+  static_assert(MPC_FAULT_LIMIT > 0, "MPC_FAULT_LIMIT must be greater than 0.");
+#endif
+
+#if ENABLED(MAX_TC_SCHEDULER) && !HAS_MAX_TC
+  #error "MAX_TC_SCHEDULER requires a MAX6675, MAX31855, or MAX31865 temperature sensor."
+#endif
+
+#if ENABLED(THERMAL_TRACE) && DISABLED(AUTO_REPORT_TEMPERATURES)
+  #error "THERMAL_TRACE requires AUTO_REPORT_TEMPERATURES."
+#endif
+
+#if ENABLED(HEATER_POWER_BUDGET)
+  #if !HAS_HOTEND
+    #error "HEATER_POWER_BUDGET requires at least one hotend."
+  #elif ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_POWER_BUDGET is not compatible with SLOW_PWM_HEATERS."
+  #elif ENABLED(SOFT_PWM_DITHER)
+    #error "HEATER_POWER_BUDGET is not compatible with SOFT_PWM_DITHER."
+  #endif
+  constexpr uint16_t _hotend_heater_power[] = HOTEND_HEATER_POWER;
+  static_assert(COUNT(_hotend_heater_power) >= HOTENDS, "HOTEND_HEATER_POWER must have at least HOTENDS values.");
+  constexpr bool _hotend_heater_power_ok(const uint8_t e=0) { return e >= HOTENDS || (_hotend_heater_power[e] > 0 && _hotend_heater_power_ok(e + 1)); }
+  static_assert(_hotend_heater_power_ok(), "HOTEND_HEATER_POWER values must be greater than 0.");
+  #if HAS_HEATED_BED
+    static_assert(BED_HEATER_POWER > 0, "BED_HEATER_POWER must be greater than 0.");
+  #endif
+  #if HAS_HEATED_CHAMBER
+    static_assert(CHAMBER_HEATER_POWER > 0, "CHAMBER_HEATER_POWER must be greater than 0.");
+  #endif
+#endif
+
+#if ENABLED(SOFT_PWM_SIGMA_DELTA)
+  #if ENABLED(SLOW_PWM_HEATERS)
+    #error "SOFT_PWM_SIGMA_DELTA is not compatible with SLOW_PWM_HEATERS."
+  #elif ENABLED(SOFT_PWM_DITHER)
+    #error "SOFT_PWM_SIGMA_DELTA is not compatible with SOFT_PWM_DITHER."
+  #elif ENABLED(HEATER_POWER_BUDGET)
+    #error "SOFT_PWM_SIGMA_DELTA is not compatible with HEATER_POWER_BUDGET."
+  #endif
+#endif
+
+#if ENABLED(HARDWARE_PWM_HEATERS)
+  #if !(HAS_HOTEND || HAS_HEATED_BED)
+    #error "HARDWARE_PWM_HEATERS requires a hotend or heated bed."
+  #elif ENABLED(SLOW_PWM_HEATERS)
+    #error "HARDWARE_PWM_HEATERS is not compatible with SLOW_PWM_HEATERS."
+  #elif ENABLED(HEATER_POWER_BUDGET)
+    #error "HARDWARE_PWM_HEATERS is not compatible with HEATER_POWER_BUDGET."
+  #elif ENABLED(HEATERS_PARALLEL)
+    #error "HARDWARE_PWM_HEATERS is not compatible with HEATERS_PARALLEL."
+  #elif defined(BOARD_OPENDRAIN_MOSFETS)
+    #error "HARDWARE_PWM_HEATERS is not compatible with BOARD_OPENDRAIN_MOSFETS."
+  #endif
+  static_assert(HARDWARE_PWM_HEATERS_FREQUENCY > 0, "HARDWARE_PWM_HEATERS_FREQUENCY must be greater than 0.");
+#endif
+
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
@@ -1060,6 +1141,16 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #elif AUTOTEMP_MAX < AUTOTEMP_MIN
     #error "AUTOTEMP_MAX must be greater than or equal to AUTOTEMP_MIN."
   #endif
+  #if ENABLED(AUTOTEMP_VOLUMETRIC)
+    #ifndef AUTOTEMP_FLOW_WINDOW
+      #error "AUTOTEMP_VOLUMETRIC requires AUTOTEMP_FLOW_WINDOW."
+    #elif !defined(AUTOTEMP_FLOW_POINTS)
+      #error "AUTOTEMP_VOLUMETRIC requires AUTOTEMP_FLOW_POINTS."
+    #elif !defined(AUTOTEMP_FLOW_CURVES)
+      #error "AUTOTEMP_VOLUMETRIC requires AUTOTEMP_FLOW_CURVES."
+    #endif
+    static_assert(AUTOTEMP_FLOW_WINDOW > 0, "AUTOTEMP_FLOW_WINDOW must be greater than 0.");
+  #endif
 #endif
 
 /**
@@ -2304,6 +2395,18 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "CONTROLLER_FAN_MIN_SOC_TEMP requires TEMP_SENSOR_SOC."
 #endif
 
+// ADC scan sampling is only available for some STM32 MCUs and LPC176x
+#if ENABLED(ADC_SCAN_SAMPLING)
+  #if ENABLED(HAL_STM32)
+    // checks for STM32 are located in HAL/STM32/inc/SanityCheck.h
+  #elif NONE(TARGET_LPC1768, __PLAT_LINUX__)
+    #error "ADC_SCAN_SAMPLING is only available for STM32F1, STM32F4, STM32G0 and LPC176x."
+  #endif
+  #if !WITHIN(ADC_SCAN_OVERSAMPLE, 2, 32) || (ADC_SCAN_OVERSAMPLE & (ADC_SCAN_OVERSAMPLE - 1))
+    #error "ADC_SCAN_OVERSAMPLE must be a power of 2 from 2 to 32."
+  #endif
+#endif
+
 #if ENABLED(LASER_COOLANT_FLOW_METER) && !(PIN_EXISTS(FLOWMETER) && ENABLED(LASER_FEATURE))
   #error "LASER_COOLANT_FLOW_METER requires FLOWMETER_PIN and LASER_FEATURE."
 #endif
@@ -2711,6 +2814,18 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+#if ENABLED(SD_CLUSTER_CACHE) && !WITHIN(SD_CLUSTER_CACHE_RUNS, 1, 255)
+  #error "SD_CLUSTER_CACHE_RUNS must be from 1 to 255."
+#endif
+
+#if ENABLED(SD_DIR_INDEX) && !WITHIN(SD_DIR_INDEX_LIMIT, 1, 32767)
+  #error "SD_DIR_INDEX_LIMIT must be from 1 to 32767."
+#endif
+
+#if ALL(SD_STREAM_READS, ONBOARD_SDIO)
+  #error "SD_STREAM_READS only applies to SPI SD cards. Disable it with ONBOARD_SDIO."
+#endif
+
 #if ENABLED(SD_IGNORE_AT_STARTUP)
   #if ENABLED(POWER_LOSS_RECOVERY)
     #error "SD_IGNORE_AT_STARTUP is incompatible with POWER_LOSS_RECOVERY."
@@ -2825,6 +2940,42 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "TFT_(COLOR|CLASSIC|LVGL)_UI requires a TFT display to be enabled."
 #endif
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  #if DISABLED(TFT_COLOR_UI)
+    #error "TFT_DOUBLE_BUFFER requires TFT_COLOR_UI."
+  #elif ENABLED(TFT_SHARED_IO)
+    #error "TFT_DOUBLE_BUFFER requires async data transfer. Disable TFT_SHARED_IO."
+  #endif
+#endif
+
+#if ENABLED(UI_PLANNER_BUDGET)
+  #if !defined(UI_HEADROOM_PERCENT) || !defined(UI_MAX_DEFER_MS)
+    #error "UI_PLANNER_BUDGET requires UI_HEADROOM_PERCENT and UI_MAX_DEFER_MS."
+  #elif !WITHIN(UI_HEADROOM_PERCENT, 1, 100)
+    #error "UI_HEADROOM_PERCENT must be between 1 and 100."
+  #endif
+#endif
+
+#if ENABLED(UI_RENDER_STATS)
+  #if !HAS_MARLINUI_MENU
+    #error "UI_RENDER_STATS requires a MarlinUI display with menus."
+  #elif !WITHIN(UI_RENDER_SCREENS, 1, 255)
+    #error "UI_RENDER_SCREENS must be between 1 and 255."
+  #endif
+#endif
+
+#if ENABLED(TFT_GLYPH_CACHE)
+  #if DISABLED(TFT_COLOR_UI)
+    #error "TFT_GLYPH_CACHE requires TFT_COLOR_UI."
+  #elif !defined(TFT_GLYPH_CACHE_SIZE) || !defined(TFT_GLYPH_CACHE_GLYPHS)
+    #error "TFT_GLYPH_CACHE requires TFT_GLYPH_CACHE_SIZE and TFT_GLYPH_CACHE_GLYPHS."
+  #elif !WITHIN(TFT_GLYPH_CACHE_SIZE, 512, 65534)
+    #error "TFT_GLYPH_CACHE_SIZE must be between 512 and 65534 bytes."
+  #elif !WITHIN(TFT_GLYPH_CACHE_GLYPHS, 1, 255)
+    #error "TFT_GLYPH_CACHE_GLYPHS must be between 1 and 255."
+  #endif
+#endif
+
 #if ENABLED(TFT_GENERIC) && NONE(TFT_INTERFACE_FSMC, TFT_INTERFACE_SPI)
   #error "TFT_GENERIC requires either TFT_INTERFACE_FSMC or TFT_INTERFACE_SPI interface."
 #elif ALL(TFT_INTERFACE_FSMC, TFT_INTERFACE_SPI)
@@ -3736,6 +3887,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "POWER_LOSS_RECOVER_ZHOME is not needed on a machine that homes to ZMAX."
   #elif ALL(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_SECTORS, 1, 255)
+    #error "POWER_LOSS_JOURNAL_SECTORS must be from 1 to 255."
   #endif
 #endif
 
@@ -4057,6 +4210,25 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "TOUCH_SCREEN_CALIBRATION is not supported by the selected LCD controller."
 #endif
 
+// Touch panel sampled from the temperature ISR
+#if ENABLED(TOUCH_ISR_SAMPLING)
+  #if NONE(TFT_COLOR_UI, HAS_RES_TOUCH_BUTTONS) || DISABLED(TFT_TOUCH_DEVICE_XPT2046)
+    #error "TOUCH_ISR_SAMPLING requires an XPT2046 touch panel with TFT_COLOR_UI or TFT_CLASSIC_UI."
+  #elif !PIN_EXISTS(TOUCH_SCK)
+    #error "TOUCH_ISR_SAMPLING requires TOUCH_SCK_PIN."
+  #elif (PIN_EXISTS(TFT_SCK) && TOUCH_SCK_PIN == TFT_SCK_PIN) || (PIN_EXISTS(SD_SCK) && TOUCH_SCK_PIN == SD_SCK_PIN)
+    #error "TOUCH_ISR_SAMPLING requires touch SPI pins not shared with the TFT or SD card."
+  #elif ENABLED(TOUCH_BUTTONS_HW_SPI)
+    #error "TOUCH_ISR_SAMPLING is not compatible with TOUCH_BUTTONS_HW_SPI."
+  #elif !WITHIN(TOUCH_SAMPLE_DEBOUNCE, 3, 50)
+    #error "TOUCH_SAMPLE_DEBOUNCE must be between 3 and 50."
+  #elif !WITHIN(TOUCH_IIR_SHIFT, 0, 6)
+    #error "TOUCH_IIR_SHIFT must be between 0 and 6."
+  #elif !WITHIN(TOUCH_EVENT_QUEUE, 4, 32)
+    #error "TOUCH_EVENT_QUEUE must be between 4 and 32."
+  #endif
+#endif
+
 /**
  * Sanity check WiFi options
  */
@@ -4260,6 +4432,34 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #endif
 #endif
 
+/**
+ * Differential display updates
+ */
+#if ENABLED(EXTUI_DIFF_UPDATES)
+  #if !HAS_DGUS_LCD_CLASSIC
+    #error "EXTUI_DIFF_UPDATES requires DGUS_LCD_UI ORIGIN, FYSETC, HIPRECY, or MKS."
+  #elif !WITHIN(EXTUI_DIFF_VARS, 1, 255)
+    #error "EXTUI_DIFF_VARS must be between 1 and 255."
+  #elif EXTUI_RESEND_MS < EXTUI_FIELD_MIN_MS
+    #error "EXTUI_RESEND_MS must be at least EXTUI_FIELD_MIN_MS."
+  #elif DGUS_TX_BUFFER_SIZE < 16
+    #error "EXTUI_DIFF_UPDATES requires a DGUS_TX_BUFFER_SIZE of at least 16."
+  #endif
+#endif
+
+/**
+ * DWIN command queue
+ */
+#if ENABLED(DWIN_TX_QUEUE)
+  #if NONE(HAS_DWIN_E3V2, IS_DWIN_MARLINUI)
+    #error "DWIN_TX_QUEUE requires an Ender-3 V2 style DWIN display."
+  #elif !defined(LCD_SERIAL_TX_BUFFER_FREE)
+    #error "DWIN_TX_QUEUE is not supported on this platform."
+  #elif !WITHIN(DWIN_TX_QUEUE_SIZE, 512, 32767)
+    #error "DWIN_TX_QUEUE_SIZE must be between 512 and 32767."
+  #endif
+#endif
+
 /**
  * Require certain features for DGUS_LCD_UI E3S1PRO.
  */
@@ -55,6 +55,14 @@
 #include "../../module/printcounter.h"
 #include "../../MarlinCore.h"
 
+#if ENABLED(DOGM_DIRTY_PAGES)
+  #include "../../libs/crc16.h"
+#endif
+
+#if ENABLED(UI_RENDER_STATS)
+  #include "../render_stats.h"
+#endif
+
 #if HAS_MEDIA
   #include "../../libs/duration_t.h"
 #endif
@@ -296,12 +304,74 @@ bool MarlinUI::detected() { return true; }
   #include "status_screen_lite_ST7920.h"
 #endif
 
+#if ENABLED(DOGM_DIRTY_PAGES)
+
+  /**
+   * Send only the page stripes that changed since the last frame.
+   * Every stripe is still drawn into the page buffer, but a CRC of the
+   * buffer decides whether it goes out over the display bus. This
+   * wraps the display's own device function, so it works with any of the
+   * monochrome u8g page-buffer devices.
+   */
+  #define DIRTY_PAGE_COUNT ((LCD_PIXEL_HEIGHT) / 8)
+  static_assert(DIRTY_PAGE_COUNT <= 8, "DOGM_DIRTY_PAGES supports up to 8 page stripes.");
+
+  static u8g_dev_fnptr dogm_dev_fn;
+  static uint16_t page_crc[DIRTY_PAGE_COUNT];
+  static uint8_t page_valid; // Bit set for each stripe known to match the display
+
+  static uint8_t dirty_pages_dev_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+    switch (msg) {
+      case U8G_DEV_MSG_INIT: page_valid = 0; break;
+
+      #if DOGM_FULL_REFRESH_SECONDS
+        case U8G_DEV_MSG_PAGE_FIRST: {
+          static millis_t next_full_refresh_ms; // = 0
+          const millis_t ms = millis();
+          if (ELAPSED(ms, next_full_refresh_ms)) {
+            page_valid = 0;
+            next_full_refresh_ms = ms + SEC_TO_MS(DOGM_FULL_REFRESH_SECONDS);
+          }
+        } break;
+      #endif
+
+      case U8G_DEV_MSG_PAGE_NEXT: {
+        u8g_pb_t * const pb = (u8g_pb_t *)dev->dev_mem;
+        const uint8_t * const buf = (uint8_t *)pb->buf;
+        const uint16_t size = pb->width * pb->p.page_height / 8;
+
+        uint16_t crc = 0;
+        crc16(&crc, buf, size);
+
+        const uint8_t page = pb->p.page;
+        if (TEST(page_valid, page) && page_crc[page] == crc) {
+          TERN_(UI_RENDER_STATS, RenderStats::unsent(size));
+          // Skip sending. Go to the next stripe just like the page buffer base function.
+          if (!u8g_page_Next(&pb->p)) return 0;
+          memset(pb->buf, 0, size);
+          return 1;
+        }
+        page_crc[page] = crc;
+        SBI(page_valid, page);
+      } break;
+    }
+    return dogm_dev_fn(u8g, dev, msg, arg);
+  }
+
+#endif // DOGM_DIRTY_PAGES
+
 // Initialize or re-initialize the LCD
 void MarlinUI::init_lcd() {
 
   static bool did_init_u8g = false;
   if (!did_init_u8g) {
     u8g.init(U8G_PARAM);
+    #if ENABLED(DOGM_DIRTY_PAGES)
+      // Hook the display device before any rotation device is chained in front of it
+      u8g_dev_t * const dev = u8g.getU8g()->dev;
+      dogm_dev_fn = dev->dev_fn;
+      dev->dev_fn = dirty_pages_dev_fn;
+    #endif
     did_init_u8g = true;
   }
 
@@ -463,6 +533,14 @@ void MarlinUI::clear_for_drawing() {
     return true;
   }
 
+  #if ENABLED(MENU_PAGE_CULLING)
+    // Does the current page include any part of a menu row, as drawn by mark_as_selected?
+    bool MarlinUI::row_on_page(const uint8_t row) {
+      const u8g_uint_t y1 = row * (MENU_FONT_HEIGHT) + 1, y2 = y1 + MENU_FONT_HEIGHT - 1;
+      return PAGE_CONTAINS(y1, y2 + 2);
+    }
+  #endif
+
   // Draw a static line of text in the same idiom as a menu item
   void MenuItem_static::draw(const uint8_t row, FSTR_P const ftpl, const uint8_t style/*=SS_DEFAULT*/, const char *vstr/*=nullptr*/) {
     if (!mark_as_selected(row, style & SS_INVERT)) return;
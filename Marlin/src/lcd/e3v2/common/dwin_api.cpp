@@ -31,16 +31,160 @@
 
 #include <string.h> // for memset
 
+#if ENABLED(UI_RENDER_STATS)
+  #include "../../render_stats.h"
+#endif
+
 uint8_t dwinSendBuf[11 + DWIN_WIDTH / 6 * 2] = { 0xAA };
 uint8_t dwinBufTail[4] = { 0xCC, 0x33, 0xC3, 0x3C };
 uint8_t databuf[26] = { 0 };
 
-// Send the data in the buffer plus the packet tail
-void dwinSend(size_t &i) {
-  ++i;
-  for (uint8_t n = 0; n < i; ++n) { LCD_SERIAL.write(dwinSendBuf[n]); delayMicroseconds(1); }
-  for (uint8_t n = 0; n < 4; ++n) { LCD_SERIAL.write(dwinBufTail[n]); delayMicroseconds(1); }
-}
+#if ENABLED(DWIN_TX_QUEUE)
+
+  /**
+   * Commands are queued whole and passed to the serial port only as fast as
+   * its interrupt-driven Tx buffer takes them, so drawing never waits on the
+   * wire. A value redrawn in the same place before the previous one has gone
+   * out replaces it in the queue.
+   */
+  dwin_queue_stats_t dwinQueueStats; // = { 0 }
+
+  static uint8_t dwinQueue[DWIN_TX_QUEUE_SIZE];
+  static uint16_t q_read, q_write;  // Bytes before q_read are sent, q_write is the end of the queue
+
+  // What a command covers on the screen. Only opaque draws get a key.
+  typedef struct { uint8_t cmd, flags; uint16_t a, b, c, d, extent; } dwin_key_t;
+
+  static struct { int32_t start; dwin_key_t key; } q_prev, q_last; // The two newest records
+  static bool group_next, group_open; // Keep a clearing rectangle together with what is drawn on it
+
+  static bool sameArea(const dwin_key_t &k1, const dwin_key_t &k2) {
+    return k1.cmd == k2.cmd && k1.flags == k2.flags && k1.a == k2.a && k1.b == k2.b && k1.c == k2.c && k1.d == k2.d;
+  }
+
+  static dwin_key_t commandKey(const size_t len, const bool grouped) {
+    const uint8_t * const b = dwinSendBuf;
+    #define BUFWORD(N) uint16_t(b[N] << 8 | b[(N) + 1])
+    dwin_key_t k = { 0 };
+    switch (b[1]) {
+      case 0x05: // Filled rectangle
+        if (b[2] == 1) k = { 0x05, 1, BUFWORD(5), BUFWORD(7), BUFWORD(9), BUFWORD(11), 0 };
+        break;
+      case 0x11: // String, covering only its own length
+        if (grouped || TEST(b[2], 6)) k = { 0x11, b[2], BUFWORD(7), BUFWORD(9), 0, 0, uint16_t(len - 11) };
+        break;
+      case 0x14: // Number, covering a fixed number of digits
+        if (grouped || TEST(b[2], 7)) k = { 0x14, b[2], BUFWORD(7), BUFWORD(9), BUFWORD(11), 0, 0 };
+        break;
+    }
+    #undef BUFWORD
+    return k;
+  }
+
+  static void updateDepth() {
+    dwinQueueStats.depth = q_write - q_read;
+    NOLESS(dwinQueueStats.peak, dwinQueueStats.depth);
+  }
+
+  void dwinService() {
+    if (group_open) return;
+    for (size_t room = LCD_SERIAL_TX_BUFFER_FREE(); room && q_read < q_write; --room)
+      LCD_SERIAL.write(dwinQueue[q_read++]);
+    if (q_read == q_write) {
+      q_read = q_write = 0;
+      q_prev.key.cmd = q_last.key.cmd = 0;
+    }
+    updateDepth();
+  }
+
+  // Make room for a command at the end of the queue
+  static void reserve(const size_t len) {
+    if (q_write + len <= DWIN_TX_QUEUE_SIZE) return;
+
+    // Move the unsent part to the front
+    const uint16_t shift = q_read;
+    memmove(dwinQueue, dwinQueue + shift, q_write - shift);
+    q_read = 0;
+    q_write -= shift;
+    q_prev.start -= shift;
+    q_last.start -= shift;
+    if (q_prev.start < 0) q_prev.key.cmd = 0;
+    if (q_last.start < 0) q_last.key.cmd = 0;
+    if (q_write + len <= DWIN_TX_QUEUE_SIZE) return;
+
+    // Still full, so wait for it to empty
+    dwinQueueStats.stalls++;
+    while (q_read < q_write) LCD_SERIAL.write(dwinQueue[q_read++]);
+    q_read = q_write = 0;
+    q_prev.key.cmd = q_last.key.cmd = 0;
+    q_last.start = 0;
+  }
+
+  void dwinSend(size_t &i) {
+    ++i;
+    reserve(i + 4);
+    #if ENABLED(UI_RENDER_STATS)
+      RenderStats::feed(dwinSendBuf, i);
+      RenderStats::feed(dwinBufTail, 4);
+    #endif
+
+    const bool extend = group_open;
+    if (!extend) {
+      q_prev = q_last;
+      q_last.start = q_write;
+    }
+    memcpy(dwinQueue + q_write, dwinSendBuf, i);
+    memcpy(dwinQueue + q_write + i, dwinBufTail, 4);
+    q_write += i + 4;
+    dwinQueueStats.commands++;
+
+    group_open = group_next;
+    group_next = false;
+    if (group_open) return;
+
+    q_last.key = commandKey(i, extend);
+    // A group covers its clearing rectangle, so compare the right edge of that
+    if (extend && q_last.start >= 0) {
+      const uint8_t * const r = dwinQueue + q_last.start;
+      q_last.key.extent = r[9] << 8 | r[10];
+    }
+
+    // Drop the previous record if this one covers the same area and it hasn't started out
+    if (q_last.key.cmd && q_prev.key.cmd && q_read <= q_prev.start
+      && sameArea(q_last.key, q_prev.key) && q_last.key.extent >= q_prev.key.extent
+    ) {
+      memmove(dwinQueue + q_prev.start, dwinQueue + q_last.start, q_write - q_last.start);
+      TERN_(UI_RENDER_STATS, RenderStats::unsent(uint16_t(q_last.start - q_prev.start)));
+      q_write -= q_last.start - q_prev.start;
+      q_last.start = q_prev.start;
+      q_prev.key.cmd = 0;
+      dwinQueueStats.coalesced++;
+    }
+
+    dwinService();
+  }
+
+  void dwinFlush() {
+    while (q_read < q_write) dwinService();
+    LCD_SERIAL.flushTX();
+  }
+
+#else
+
+  // Send the data in the buffer plus the packet tail
+  void dwinSend(size_t &i) {
+    ++i;
+    #if ENABLED(UI_RENDER_STATS)
+      RenderStats::feed(dwinSendBuf, i);
+      RenderStats::feed(dwinBufTail, 4);
+    #endif
+    for (uint8_t n = 0; n < i; ++n) { LCD_SERIAL.write(dwinSendBuf[n]); delayMicroseconds(1); }
+    for (uint8_t n = 0; n < 4; ++n) { LCD_SERIAL.write(dwinBufTail[n]); delayMicroseconds(1); }
+  }
+
+  void dwinFlush() { LCD_SERIAL.flushTX(); }
+
+#endif
 
 /*-------------------------------------- System variable function --------------------------------------*/
 
@@ -57,6 +201,7 @@ bool dwinHandshake() {
   size_t i = 0;
   dwinByte(i, 0x00);
   dwinSend(i);
+  TERN_(DWIN_TX_QUEUE, dwinFlush());
 
   while (LCD_SERIAL.available() > 0 && recnum < (signed)sizeof(databuf)) {
     databuf[recnum] = LCD_SERIAL.read();
@@ -241,6 +386,7 @@ void dwinFrameAreaMove(uint8_t mode, uint8_t dir, uint16_t dis,
 //  rlimit: To limit the drawn string length
 void dwinDrawString(bool bShow, uint8_t size, uint16_t color, uint16_t bColor, uint16_t x, uint16_t y, const char * const string, uint16_t rlimit/*=0xFFFF*/) {
   #if ENABLED(DWIN_CREALITY_LCD)
+    TERN_(DWIN_TX_QUEUE, group_next = true);
     dwinDrawRectangle(1, bColor, x, y, x + (fontWidth(size) * strlen_P(string)), y + fontHeight(size));
   #endif
   constexpr uint8_t widthAdjust = 0;
@@ -273,6 +419,7 @@ void dwinDrawIntValue(uint8_t bShow, bool zeroFill, uint8_t zeroMode, uint8_t si
                           uint16_t bColor, uint8_t iNum, uint16_t x, uint16_t y, uint32_t value) {
   size_t i = 0;
   #if DISABLED(DWIN_CREALITY_LCD_JYERSUI)
+    TERN_(DWIN_TX_QUEUE, group_next = true);
     dwinDrawRectangle(1, bColor, x, y, x + fontWidth(size) * iNum + 1, y + fontHeight(size));
   #endif
   dwinByte(i, 0x14);
@@ -323,6 +470,7 @@ void dwinDrawFloatValue(uint8_t bShow, bool zeroFill, uint8_t zeroMode, uint8_t
   //uint8_t *fvalue = (uint8_t*)&value;
   size_t i = 0;
   #if DISABLED(DWIN_CREALITY_LCD_JYERSUI)
+    TERN_(DWIN_TX_QUEUE, group_next = true);
     dwinDrawRectangle(1, bColor, x, y, x + fontWidth(size) * (iNum + fNum + 1), y + fontHeight(size));
   #endif
   dwinByte(i, 0x14);
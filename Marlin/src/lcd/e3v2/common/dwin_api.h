@@ -70,6 +70,24 @@ inline void dwinLong(size_t &i, const uint32_t lval) {
 // Send the data in the buffer plus the packet tail
 void dwinSend(size_t &i);
 
+// Wait until all commands have gone out to the display
+void dwinFlush();
+
+#if ENABLED(DWIN_TX_QUEUE)
+  typedef struct {
+    uint16_t depth,     // Bytes waiting in the queue
+             peak;      // Most bytes seen waiting
+    uint32_t commands,  // Commands queued
+             coalesced, // Commands replaced by a later one before being sent
+             stalls;    // Times the queue was full and drawing had to wait
+  } dwin_queue_stats_t;
+
+  extern dwin_queue_stats_t dwinQueueStats;
+
+  // Pass queued commands to the serial port as far as it has room
+  void dwinService();
+#endif
+
 inline void dwinText(size_t &i, const char * const string, uint16_t rlimit=0xFFFF) {
   if (!string) return;
   const size_t len = _MIN(sizeof(dwinSendBuf) - i, _MIN(strlen(string), rlimit));
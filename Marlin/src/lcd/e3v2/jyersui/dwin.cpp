@@ -385,7 +385,7 @@ private:
         );
 
         safe_delay(10);
-        LCD_SERIAL.flushTX();
+        dwinFlush();
 
         // Draw value text on
         if (viewer_print_value) {
@@ -405,7 +405,7 @@ private:
             dwinDrawString(false, font6x12, COLOR_WHITE, COLOR_BG_BLUE, start_x_px + 1 + offset_x, start_y_px + offset_y /*+ square / 2 - 6*/, msg);
           }
           safe_delay(10);
-          LCD_SERIAL.flushTX();
+          dwinFlush();
         }
       }
     }
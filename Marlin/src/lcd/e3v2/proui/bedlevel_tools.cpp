@@ -234,7 +234,7 @@ bool BedLevelTools::meshValidate() {
       dwinDrawRectangle(1, color, start_x_px, start_y_px, end_x_px, end_y_px);
 
       safe_delay(10);
-      LCD_SERIAL.flushTX();
+      dwinFlush();
 
       // Draw value text on
       if (!viewer_print_value) continue;
@@ -258,7 +258,7 @@ bool BedLevelTools::meshValidate() {
       }
 
       safe_delay(10);
-      LCD_SERIAL.flushTX();
+      dwinFlush();
 
     } // GRID_LOOP
   }
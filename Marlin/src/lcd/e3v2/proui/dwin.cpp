@@ -1911,6 +1911,7 @@ void MarlinUI::init_lcd() {
   const bool hs = dwinHandshake(); UNUSED(hs);
   dwinFrameSetDir(1);
   dwinJPGCacheTo1(Language_English);
+  TERN_(HAS_GCODE_PREVIEW, preview.forget());
 }
 
 void MarlinUI::clear_lcd() {}
@@ -2103,6 +2104,7 @@ void rebootPrinter() {
   thermalManager.disable_all_heaters();
   planner.finish_and_disable();
   dwinRebootScreen();
+  TERN_(DWIN_TX_QUEUE, dwinFlush()); // Send the reboot screen before resetting
   hal.reboot();
 }
 
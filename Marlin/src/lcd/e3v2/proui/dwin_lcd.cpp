@@ -111,6 +111,8 @@ void dwinWriteToMem(uint8_t mem, uint16_t addr, uint16_t length, uint8_t *data)
   uint16_t indx;
   uint8_t block = 0;
 
+  TERN_(DWIN_TX_QUEUE, dwinFlush()); // Data goes straight to the port, after anything queued
+
   while (pending > 0) {
     indx = block * max_size;
     to_send = _MIN(pending, max_size);
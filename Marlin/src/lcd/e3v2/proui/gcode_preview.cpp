@@ -80,6 +80,77 @@ typedef struct {
 
 fileprop_t fileprop;
 
+// The file whose JPEG thumbnail is currently held in display SRAM
+typedef struct {
+  char name[13] = "";
+  uint32_t dir = 0;       // First cluster of the folder holding the file, since names repeat across folders
+  uint32_t cluster = 0;   // First cluster and last write time of the file,
+  uint32_t datetime = 0;  // which change when the file is uploaded again
+  uint32_t filesize = 0, thumbstart = 0;
+  int b64size = 0, jpegsize = 0;
+
+  bool matches(const fileprop_t &fp) const {
+    return jpegsize && dir == card.getWorkDir().firstCluster() && cluster == card.getFileCluster()
+        && datetime == card.getFileDateTime() && filesize == card.getFileSize()
+        && thumbstart == fp.thumbstart && b64size == fp.thumbsize && !strcmp(name, fp.name);
+  }
+
+  void set(const fileprop_t &fp, const int size) {
+    strcpy(name, fp.name);
+    dir = card.getWorkDir().firstCluster();
+    cluster = card.getFileCluster();
+    datetime = card.getFileDateTime();
+    filesize = card.getFileSize();
+    thumbstart = fp.thumbstart;
+    b64size = fp.thumbsize;
+    jpegsize = size;
+  }
+
+  void clear() { jpegsize = 0; }
+
+} thumbcache_t;
+
+thumbcache_t loaded;
+
+/**
+ * Decode the base64 thumbnail at the current file position straight into
+ * display SRAM, one 128-byte write block at a time, so no buffer for the
+ * whole image is needed. Comment prefixes and line breaks are skipped.
+ * Return the decoded JPEG size, or 0 if the file ended early.
+ */
+int streamThumbnail(const int b64size) {
+  uint8_t in[64], out[128];
+  uint16_t bits = 0, addr = 0;
+  uint8_t nbits = 0, nout = 0;
+  int nread = 0;
+
+  while (nread < b64size) {
+    const int16_t n = card.read(in, sizeof(in));
+    if (n <= 0) return 0;
+    for (int16_t i = 0; i < n && nread < b64size; ++i) {
+      const uint8_t c = in[i];
+      if (ISEOL(c) || c == ';' || c == ' ') continue;
+      ++nread;
+      const uint8_t v = base64_to_binary(c);
+      if (v > 63) continue;               // '=' padding
+      bits = (bits << 6) | v;
+      nbits += 6;
+      if (nbits >= 8) {
+        nbits -= 8;
+        out[nout++] = uint8_t(bits >> nbits);
+        if (nout == sizeof(out)) {
+          DWINUI::writeToSRAM(addr, nout, out);
+          addr += nout;
+          nout = 0;
+        }
+      }
+    }
+  }
+
+  if (nout) DWINUI::writeToSRAM(addr, nout, out);
+  return addr + nout;
+}
+
 void getValue(const char * const buf, PGM_P const key, float &value) {
   if (value != 0.0f) return;
 
@@ -163,19 +234,22 @@ bool Preview::hasPreview() {
     return false;
   }
 
-  uint8_t buf64[fileprop.thumbsize + 1];
-  uint16_t nread = 0;
-  while (nread < fileprop.thumbsize) {
-    const uint8_t c = card.get();
-    if (!ISEOL(c) && c != ';' && c != ' ')
-      buf64[nread++] = c;
+  // Reuse the JPEG still in display SRAM if this is the same thumbnail
+  if (loaded.matches(fileprop)) {
+    card.closefile();
+    fileprop.thumbsize = loaded.jpegsize;
+  }
+  else {
+    loaded.clear();
+    const int jpegsize = streamThumbnail(fileprop.thumbsize);
+    card.closefile();
+    if (!jpegsize) {
+      LCD_MESSAGE_F("Invalid Thumbnail Size");
+      return false;
+    }
+    loaded.set(fileprop, jpegsize);
+    fileprop.thumbsize = jpegsize;
   }
-  card.closefile();
-  buf64[nread] = '\0';
-
-  uint8_t thumbdata[3 + 3 * (fileprop.thumbsize / 4)];  // Reserve space for the JPEG thumbnail
-  fileprop.thumbsize = decode_base64(buf64, thumbdata);
-  DWINUI::writeToSRAM(0x00, fileprop.thumbsize, thumbdata);
 
   fileprop.thumbwidth = THUMBWIDTH;
   fileprop.thumbheight = THUMBHEIGHT;
@@ -219,6 +293,11 @@ void Preview::invalidate() {
   fileprop.thumbsize = 0;
 }
 
+// The display was reset so its SRAM no longer holds the thumbnail
+void Preview::forget() {
+  loaded.clear();
+}
+
 bool Preview::valid() {
   return !!fileprop.thumbsize;
 }
@@ -32,6 +32,7 @@ class Preview {
 public:
   static void drawFromSD();
   static void invalidate();
+  static void forget();
   static bool valid();
   static void show();
 private:
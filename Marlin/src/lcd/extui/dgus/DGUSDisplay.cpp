@@ -44,6 +44,10 @@
 #include "DGUSVPVariable.h"
 #include "DGUSDisplayDef.h"
 
+#if ENABLED(EXTUI_DIFF_UPDATES)
+  #include "../var_cache.h"
+#endif
+
 DGUSDisplay dgus;
 
 #ifdef DEBUG_DGUS_COMM
@@ -59,6 +63,9 @@ constexpr uint8_t DGUS_HEADER2 = 0xA5;
 constexpr uint8_t DGUS_CMD_WRITEVAR = 0x82;
 constexpr uint8_t DGUS_CMD_READVAR = 0x83;
 
+// Variables below this address are system registers, like the page switch
+constexpr uint16_t DGUS_VP_MIN = 0x1000;
+
 #if ENABLED(DEBUG_DGUSLCD)
   bool dguslcd_local_debug; // = false
 #endif
@@ -69,6 +76,8 @@ void DGUSDisplay::initDisplay() {
   #endif
   LCD_SERIAL.begin(LCD_BAUDRATE);
 
+  TERN_(EXTUI_DIFF_UPDATES, ExtUI::VarCache::reset());
+
   if (TERN1(POWER_LOSS_RECOVERY, !recovery.valid())) {  // If no Power-Loss Recovery is needed...
     TERN_(DGUS_LCD_UI_MKS, delay(LOGO_TIME_DELAY));     // Show the logo for a little while
   }
@@ -76,6 +85,73 @@ void DGUSDisplay::initDisplay() {
   requestScreen(TERN(SHOW_BOOTSCREEN, DGUS_SCREEN_BOOT, DGUS_SCREEN_MAIN));
 }
 
+#if ENABLED(EXTUI_DIFF_UPDATES)
+
+  // Copy a value as it goes out on the wire, with strings padded by spaces
+  static void copyValue(char *dst, const char *src, uint8_t len, const bool isstr, const bool pgm) {
+    bool strend = !src;
+    while (len--) {
+      char x = ' ';
+      if (!strend) {
+        x = pgm ? pgm_read_byte(src++) : *src++;
+        if (isstr && !x) { strend = true; x = ' '; }
+      }
+      *dst++ = x;
+    }
+  }
+
+  uint16_t DGUSDisplay::batch_adr;
+  uint8_t DGUSDisplay::batch_len; // = 0
+  char DGUSDisplay::batch[batch_size];
+
+  void DGUSDisplay::sendVariable(const uint16_t adr, const char *values, const uint8_t valueslen) {
+    if (adr >= DGUS_VP_MIN) {
+      if (!ExtUI::VarCache::changed(adr, values, valueslen)) return;
+
+      // Append to the pending frame if this variable follows the last one
+      if (batch_len && !(batch_len & 1) && adr == batch_adr + batch_len / 2 && batch_len + valueslen <= batch_size) {
+        memcpy(batch + batch_len, values, valueslen);
+        batch_len += valueslen;
+        ExtUI::VarCache::stats.batched++;
+        return;
+      }
+
+      flushBatch();
+      if (valueslen <= batch_size) {
+        batch_adr = adr;
+        memcpy(batch, values, valueslen);
+        batch_len = valueslen;
+        return;
+      }
+    }
+    else
+      flushBatch(); // Keep the order of writes to system registers
+
+    writeHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
+    for (uint8_t i = 0; i < valueslen; ++i) LCD_SERIAL.write(values[i]);
+  }
+
+  void DGUSDisplay::flushBatch() {
+    if (!batch_len) return;
+    writeHeader(batch_adr, DGUS_CMD_WRITEVAR, batch_len);
+    for (uint8_t i = 0; i < batch_len; ++i) LCD_SERIAL.write(batch[i]);
+    batch_len = 0;
+  }
+
+  void DGUSDisplay::writeVariable(uint16_t adr, const void *values, uint8_t valueslen, bool isstr) {
+    char myvalues[valueslen];
+    copyValue(myvalues, static_cast<const char*>(values), valueslen, isstr, false);
+    sendVariable(adr, myvalues, valueslen);
+  }
+
+  void DGUSDisplay::writeVariablePGM(uint16_t adr, const void *values, uint8_t valueslen, bool isstr) {
+    char myvalues[valueslen];
+    copyValue(myvalues, static_cast<const char*>(values), valueslen, isstr, true);
+    sendVariable(adr, myvalues, valueslen);
+  }
+
+#else
+
 void DGUSDisplay::writeVariable(uint16_t adr, const void *values, uint8_t valueslen, bool isstr) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
@@ -91,6 +167,8 @@ void DGUSDisplay::writeVariable(uint16_t adr, const void *values, uint8_t values
   }
 }
 
+#endif // !EXTUI_DIFF_UPDATES
+
 void DGUSDisplay::writeVariable(uint16_t adr, uint16_t value) {
   value = (value & 0xFFU) << 8U | (value >> 8U);
   writeVariable(adr, static_cast<const void*>(&value), sizeof(uint16_t));
@@ -120,6 +198,8 @@ void DGUSDisplay::writeVariable(uint16_t adr, long value) {
   writeVariable(adr, static_cast<const void*>(&tmp), sizeof(long));
 }
 
+#if DISABLED(EXTUI_DIFF_UPDATES)
+
 void DGUSDisplay::writeVariablePGM(uint16_t adr, const void *values, uint8_t valueslen, bool isstr) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
@@ -135,6 +215,8 @@ void DGUSDisplay::writeVariablePGM(uint16_t adr, const void *values, uint8_t val
   }
 }
 
+#endif
+
 void DGUSDisplay::processRx() {
 
   #if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
@@ -204,6 +286,7 @@ void DGUSDisplay::processRx() {
         |           Command          DataLen (in Words) */
         if (command == DGUS_CMD_READVAR) {
           const uint16_t vp = tmp[0] << 8 | tmp[1];
+          TERN_(EXTUI_DIFF_UPDATES, ExtUI::VarCache::invalidate(vp)); // The display changed it, so resend it
           DGUS_VP_Variable ramcopy;
           if (populate_VPVar(vp, &ramcopy)) {
             if (ramcopy.set_by_display_handler)
@@ -220,7 +303,15 @@ void DGUSDisplay::processRx() {
   }
 }
 
-size_t DGUSDisplay::getFreeTxBuffer() { return LCD_SERIAL_TX_BUFFER_FREE(); }
+size_t DGUSDisplay::getFreeTxBuffer() {
+  #if ENABLED(EXTUI_DIFF_UPDATES)
+    // Count the held back frame as already queued
+    const size_t free = LCD_SERIAL_TX_BUFFER_FREE(), pending = batch_len ? batch_len + 6 : 0;
+    return free > pending ? free - pending : 0;
+  #else
+    return LCD_SERIAL_TX_BUFFER_FREE();
+  #endif
+}
 
 void DGUSDisplay::writeHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen) {
   LCD_SERIAL.write(DGUS_HEADER1);
@@ -242,6 +333,7 @@ void DGUSDisplay::loop() {
     processRx();
     no_reentrance = false;
   }
+  TERN_(EXTUI_DIFF_UPDATES, flushBatch());
 }
 
 rx_datagram_state_t DGUSDisplay::rx_datagram_state = DGUS_IDLE;
@@ -99,11 +99,24 @@ public:
   // (both boils down that the display answered to our chatting)
   static bool isInitialized() { return initialized; }
 
+  #if ENABLED(EXTUI_DIFF_UPDATES)
+    // Send any variable writes held back for merging
+    static void flushBatch();
+  #endif
+
 private:
   static void writeHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen);
   static void writePGM(const char str[], uint8_t len);
   static void processRx();
 
+  #if ENABLED(EXTUI_DIFF_UPDATES)
+    static constexpr uint8_t batch_size = DGUS_TX_BUFFER_SIZE - 6; // Payload that fits the Tx buffer with the header
+    static uint16_t batch_adr;
+    static uint8_t batch_len;
+    static char batch[batch_size];
+    static void sendVariable(const uint16_t adr, const char *values, const uint8_t valueslen);
+  #endif
+
   static rx_datagram_state_t rx_datagram_state;
   static uint8_t rx_datagram_len;
   static bool initialized, no_reentrance;
@@ -40,6 +40,16 @@
   #include "../../../feature/powerloss.h"
 #endif
 
+#if ENABLED(EXTUI_DIFF_UPDATES)
+  #include "../var_cache.h"
+  // Throttle changing values during the refresh, then send the last frame
+  #define REFRESH_START() (ExtUI::VarCache::throttle = true)
+  #define REFRESH_END() do{ ExtUI::VarCache::throttle = false; dgus.flushBatch(); }while(0)
+#else
+  #define REFRESH_START() NOOP
+  #define REFRESH_END() NOOP
+#endif
+
 DGUSScreenHandlerClass screen;
 
 uint16_t DGUSScreenHandler::confirmVP;
@@ -643,6 +653,7 @@ void DGUSScreenHandler::updateScreenVPData() {
 
   // Round-robin updating of all VPs.
   VPList += update_ptr;
+  REFRESH_START();
 
   bool sent_one = false;
   do {
@@ -650,6 +661,7 @@ void DGUSScreenHandler::updateScreenVPData() {
     if (!VP) {
       update_ptr = 0;
       screenComplete = true;
+      REFRESH_END();
       return; // Screen completed.
     }
 
@@ -666,6 +678,7 @@ void DGUSScreenHandler::updateScreenVPData() {
       }
       else {
         screenComplete = false;
+        REFRESH_END();
         return; // please call again!
       }
     }
@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * lcd/extui/var_cache.cpp
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(EXTUI_DIFF_UPDATES)
+
+#include "var_cache.h"
+
+namespace ExtUI {
+
+  var_cache_stats_t VarCache::stats; // = { 0 }
+  bool VarCache::throttle; // = false
+  VarCache::entry_t VarCache::entries[EXTUI_DIFF_VARS]; // Id 0 marks an empty entry
+
+  void VarCache::reset() { ZERO(entries); }
+
+  void VarCache::invalidate(const uint16_t id) {
+    entry_t &e = entries[slot(id)];
+    if (e.id == id) e.id = 0;
+  }
+
+  bool VarCache::changed(const uint16_t id, const void * const data, const uint8_t len) {
+    // Values up to 4 bytes are kept as they are. Longer ones (strings) as a 32-bit FNV-1a hash.
+    const uint8_t *p = (const uint8_t*)data;
+    uint32_t value = 0;
+    if (len <= sizeof(value))
+      memcpy(&value, p, len);
+    else {
+      value = 2166136261UL;
+      for (uint8_t i = 0; i < len; ++i) value = (value ^ p[i]) * 16777619UL;
+    }
+
+    const millis_t ms = millis();
+    entry_t &e = entries[slot(id)];
+    if (id && e.id == id) {
+      // Unchanged values are still resent now and then, in case the display was reset
+      const bool same = e.len == len && e.value == value && PENDING(ms, e.sent_ms + (EXTUI_RESEND_MS));
+      // A changing value is not resent more often than EXTUI_FIELD_MIN_MS during refresh
+      if (same || (throttle && PENDING(ms, e.sent_ms + (EXTUI_FIELD_MIN_MS)))) {
+        stats.skipped++;
+        return false;
+      }
+    }
+
+    e.id = id;
+    e.len = len;
+    e.value = value;
+    e.sent_ms = ms;
+    stats.sent++;
+    return true;
+  }
+
+}
+
+#endif // EXTUI_DIFF_UPDATES
@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * lcd/extui/var_cache.h
+ *
+ * Remember the last value sent for each display variable (or a hash of
+ * longer strings), so serial displays are only sent the values that have changed.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+namespace ExtUI {
+
+  typedef struct {
+    uint32_t sent,    // Values sent to the display
+             skipped, // Values left out because they were unchanged or sent too recently
+             batched; // Values merged into the frame of a preceding variable
+  } var_cache_stats_t;
+
+  class VarCache {
+    public:
+      static var_cache_stats_t stats;
+      static bool throttle; // Set during periodic refresh to apply EXTUI_FIELD_MIN_MS
+
+      static void reset();
+      static void invalidate(const uint16_t id);
+
+      // Return true if the value should be sent, and remember it as sent
+      static bool changed(const uint16_t id, const void * const data, const uint8_t len);
+
+    private:
+      typedef struct { uint16_t id; uint8_t len; uint32_t value; millis_t sent_ms; } entry_t;
+      static entry_t entries[EXTUI_DIFF_VARS];
+
+      static uint8_t slot(const uint16_t id) { return (id ^ (id >> 4) ^ (id >> 9)) % (EXTUI_DIFF_VARS); }
+  };
+
+}
@@ -62,6 +62,10 @@ MarlinUI ui;
   #include "../module/printcounter.h"
 #endif
 
+#if ENABLED(UI_RENDER_STATS)
+  #include "render_stats.h"
+#endif
+
 #if LCD_HAS_WAIT_FOR_MOVE
   bool MarlinUI::wait_for_move; // = false
 #endif
@@ -938,6 +942,42 @@ void MarlinUI::init() {
     return !BUTTON_PRESSED(ENC_EN); // Update encoder only when ENC_EN is not LOW (pressed)
   }
 
+  #if ENABLED(UI_RENDER_STATS)
+    int16_t MarlinUI::script_steps; // = 0
+    bool MarlinUI::script_click; // = false
+  #endif
+
+  #if ENABLED(UI_PLANNER_BUDGET)
+
+    ui_budget_stats_t MarlinUI::budget_stats; // = { 0 }
+
+    /**
+     * Check if UI work taking about cost_ms fits within the queued move time.
+     * The UI may use UI_HEADROOM_PERCENT of the time before the planner runs
+     * dry. Work is never put off for longer than UI_MAX_DEFER_MS.
+     * Each caller keeps its own deferral. Only the screen update counts in
+     * budget_stats.
+     */
+    bool MarlinUI::budget_allows(const millis_t ms, const uint16_t cost_ms, ui_deferral_t &deferral, const bool count/*=false*/) {
+      const uint32_t headroom = uint32_t(planner.block_buffer_runtime()) * (UI_HEADROOM_PERCENT) / 100;
+      if (!headroom || headroom > cost_ms || (deferral.active && ELAPSED(ms, deferral.start_ms + (UI_MAX_DEFER_MS)))) {
+        if (deferral.active) {
+          deferral.active = false;
+          if (count) NOLESS(budget_stats.max_defer_ms, uint16_t(_MIN(ms - deferral.start_ms, 0xFFFFUL)));
+        }
+        return true;
+      }
+
+      if (!deferral.active) {
+        deferral.active = true;
+        deferral.start_ms = ms;
+        if (count) budget_stats.deferred++;
+      }
+      return false;
+    }
+
+  #endif
+
   void MarlinUI::update() {
 
     static uint16_t max_display_update_time = 0;
@@ -1000,6 +1040,20 @@ void MarlinUI::init() {
         goto_previous_screen();
       }
 
+      #if ENABLED(UI_RENDER_STATS)
+        // Clicks and encoder steps from M257, one menu item per update.
+        // Steps wait for a click to be handled, just as the encoder is ignored during a click.
+        if (script_click) {
+          script_click = false;
+          do_click();
+        }
+        else if (script_steps && !encoderDiff && !lcd_clicked) {
+          const int8_t dir = script_steps > 0 ? 1 : -1;
+          script_steps -= dir;
+          encoderDiff = dir * (ENCODER_STEPS_PER_MENU_ITEM) * epps * encoderDirection;
+        }
+      #endif
+
     #endif // HAS_MARLINUI_MENU
 
     const bool lcd_update_ms_elapsed = ELAPSED(ms, next_lcd_update_ms);
@@ -1115,10 +1169,24 @@ void MarlinUI::init() {
     }
 
     if (lcd_update_ms_elapsed || drawing_screen) {
-      // Then we want to use only 50% of the time
-      const uint16_t bbr2 = planner.block_buffer_runtime() >> 1;
+      // Only checked when there's something to draw
+      auto can_draw = [&]{
+        #if ENABLED(UI_PLANNER_BUDGET)
+          static ui_deferral_t draw_deferral; // = { false }
+          return budget_allows(ms, max_display_update_time, draw_deferral, true);
+        #else
+          // Then we want to use only 50% of the time
+          const uint16_t bbr2 = planner.block_buffer_runtime() >> 1;
+          return !bbr2 || bbr2 > max_display_update_time;
+        #endif
+      };
 
-      if ((should_draw() || drawing_screen) && (!bbr2 || bbr2 > max_display_update_time)) {
+      if ((should_draw() || drawing_screen) && can_draw()) {
+
+        #if ENABLED(UI_RENDER_STATS)
+          if (!drawing_screen) RenderStats::frame(currentScreen, lcdDrawUpdate == LCDVIEW_CLEAR_CALL_REDRAW);
+          RenderStats::begin();
+        #endif
 
         // Change state of drawing flag between screen updates
         if (!drawing_screen) switch (lcdDrawUpdate) {
@@ -1155,10 +1223,18 @@ void MarlinUI::init() {
             run_current_screen();                 // Draw and process the current screen
             first_page = false;
 
+            #if ENABLED(UI_RENDER_STATS)
+              if (drawing_screen) {
+                const u8g_pb_t * const pb = (u8g_pb_t *)u8g.getU8g()->dev->dev_mem;
+                RenderStats::feed(pb->buf, pb->width * pb->p.page_height / 8);
+              }
+            #endif
+
             // The screen handler can clear drawing_screen for an action that changes the screen.
             // If still drawing and there's another page, update max-time and return now.
             // The nextPage will already be set up on the next call.
             if (drawing_screen && (drawing_screen = u8g.nextPage())) {
+              TERN_(UI_RENDER_STATS, RenderStats::end());
               if (on_status_screen())
                 NOLESS(max_display_update_time, millis() - ms);
               return;
@@ -1177,6 +1253,9 @@ void MarlinUI::init() {
         // Used to do screen throttling when the planner starts to fill up.
         if (on_status_screen())
           NOLESS(max_display_update_time, millis() - ms);
+
+        TERN_(UI_PLANNER_BUDGET, budget_stats.frames++);
+        TERN_(UI_RENDER_STATS, RenderStats::end());
       }
 
       #if HAS_SCREEN_TIMEOUT
@@ -1215,7 +1294,9 @@ void MarlinUI::init() {
       } // switch
     }
 
-    TERN_(HAS_GRAPHICAL_TFT, tft_idle());
+    #if HAS_GRAPHICAL_TFT
+      tft_idle();
+    #endif
   }
 
   #if HAS_ADC_BUTTONS
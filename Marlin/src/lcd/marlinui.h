@@ -193,6 +193,19 @@ typedef bool (*statusResetFunc_t)();
 //////////// MarlinUI Singleton ////////////
 ////////////////////////////////////////////
 
+#if ENABLED(UI_PLANNER_BUDGET)
+  typedef struct {
+    uint32_t frames;        // Screen updates drawn
+    uint32_t deferred;      // Screen updates put off to keep the planner fed
+    uint16_t max_defer_ms;  // Longest time a screen update was put off
+  } ui_budget_stats_t;
+
+  typedef struct {
+    bool active;            // Work is being put off
+    millis_t start_ms;      // Since this time
+  } ui_deferral_t;
+#endif
+
 class MarlinUI;
 extern MarlinUI ui;
 
@@ -548,6 +561,16 @@ public:
       FORCE_INLINE static bool should_draw() { return bool(lcdDrawUpdate); }
       FORCE_INLINE static void refresh(const LCDViewAction type) { lcdDrawUpdate = type; }
 
+      #if ENABLED(UI_PLANNER_BUDGET)
+        static ui_budget_stats_t budget_stats;
+        static bool budget_allows(const millis_t ms, const uint16_t cost_ms, ui_deferral_t &deferral, const bool count=false);
+      #endif
+
+      #if ENABLED(UI_RENDER_STATS)
+        static int16_t script_steps;  // Menu items to scroll, from M257 E
+        static bool script_click;     // Click to apply, from M257 C
+      #endif
+
       #if ENABLED(SHOW_CUSTOM_BOOTSCREEN)
         static void draw_custom_bootscreen(const uint8_t frame=0);
         static void show_custom_bootscreen();
@@ -613,6 +636,9 @@ public:
 
     #if HAS_MARLINUI_U8GLIB
       static bool drawing_screen, first_page;
+      #if ENABLED(MENU_PAGE_CULLING)
+        static bool row_on_page(const uint8_t row);
+      #endif
     #else
       static constexpr bool drawing_screen = false, first_page = true;
     #endif
@@ -233,12 +233,22 @@ class MenuItem_bool : public MenuEditItemBase {
  *   _lcdLineNr is the index of the LCD line (e.g., 0-3)
  *   _menuLineNr is the menu item to draw and process
  *   _thisItemNr is the index of each MENU_ITEM or STATIC_ITEM
+ *
+ * With MENU_PAGE_CULLING the first page handles clicks, skipping and item
+ * counting for every line. Later pages only process the lines they show.
  */
+#if ENABLED(MENU_PAGE_CULLING)
+  #define MENU_LINE_ON_PAGE(L) (ui.first_page || ui.row_on_page(L))
+#else
+  #define MENU_LINE_ON_PAGE(L) true
+#endif
+
 #define SCREEN_OR_MENU_LOOP(IS_MENU)                    \
   scroll_screen(IS_MENU ? 1 : LCD_HEIGHT, IS_MENU);     \
-  int8_t _menuLineNr = encoderTopLine, _thisItemNr = 0; \
+  int8_t _menuLineNr = encoderTopLine, _thisItemNr = screen_items; \
   bool _skipStatic = IS_MENU; UNUSED(_thisItemNr);      \
-  for (int8_t _lcdLineNr = 0; _lcdLineNr < LCD_HEIGHT; _lcdLineNr++, _menuLineNr++) { \
+  for (int8_t _lcdLineNr = 0; _lcdLineNr < LCD_HEIGHT; _lcdLineNr++, _menuLineNr++) \
+  if (MENU_LINE_ON_PAGE(_lcdLineNr)) {                  \
     _thisItemNr = 0
 
 /**
@@ -0,0 +1,99 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * lcd/render_stats.cpp
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(UI_RENDER_STATS)
+
+#include "render_stats.h"
+#include "../libs/crc16.h"
+
+render_screen_stats_t RenderStats::screens[UI_RENDER_SCREENS], RenderStats::last, RenderStats::cur;
+uint8_t RenderStats::count; // = 0
+uint32_t RenderStats::start_us;
+uint16_t RenderStats::crc;
+bool RenderStats::open; // = false
+
+void RenderStats::reset() {
+  ZERO(screens);
+  last = render_screen_stats_t();
+  count = 0;
+  open = false;
+}
+
+void RenderStats::begin() { start_us = micros(); }
+
+void RenderStats::end() { if (open) cur.total_us += micros() - start_us; }
+
+void RenderStats::frame(const render_screen_t screen, const bool full) {
+  close();
+  const bool changed = screen != cur.screen; // A new screen is drawn onto a cleared display
+  cur = render_screen_stats_t();
+  cur.screen = screen;
+  cur.frames = 1;
+  cur.full = full || changed;
+  crc = 0;
+  open = true;
+}
+
+void RenderStats::feed(const void * const data, const uint16_t len) {
+  if (!open) return;
+  crc16(&crc, data, len);
+  cur.bytes += len;
+}
+
+void RenderStats::feed(const uint16_t value, const uint32_t repeat) {
+  if (!open) return;
+  const uint16_t v[] = { value, uint16_t(repeat), uint16_t(repeat >> 16) };
+  feed(v, sizeof(v));
+  cur.bytes += repeat * 2 - sizeof(v);
+}
+
+void RenderStats::close() {
+  if (!open) return;
+  open = false;
+  cur.max_us = cur.total_us;
+  cur.hash = crc;
+  last = cur;
+
+  // Add the frame to its screen, or to a free entry if the table isn't full
+  uint8_t i = 0;
+  while (i < count && screens[i].screen != cur.screen) ++i;
+  if (i == count) {
+    if (count == UI_RENDER_SCREENS) return;
+    screens[count++] = render_screen_stats_t();
+    screens[i].screen = cur.screen;
+  }
+  render_screen_stats_t &s = screens[i];
+  s.frames++;
+  s.full += cur.full;
+  s.total_us += cur.total_us;
+  NOLESS(s.max_us, cur.total_us);
+  s.bytes = cur.bytes;
+  s.hash = cur.hash;
+}
+
+#endif // UI_RENDER_STATS
@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * lcd/render_stats.h
+ *
+ * Per-screen render time, display bus traffic, and a hash of the data
+ * sent for each frame, so scripted UI runs can be compared between builds.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+typedef void (*render_screen_t)();
+
+typedef struct {
+  render_screen_t screen;
+  uint16_t frames,    // Frames drawn for this screen
+           full;      // Frames drawn after clearing the screen
+  uint32_t total_us,  // Time spent drawing and sending all frames
+           max_us,    // Longest frame
+           bytes;     // Bytes sent for the last frame
+  uint16_t hash;      // CRC16 of the data sent for the last frame
+} render_screen_stats_t;
+
+class RenderStats {
+  public:
+    static render_screen_stats_t screens[UI_RENDER_SCREENS];
+    static render_screen_stats_t last;   // The last completed frame
+    static uint8_t count;                // Screens seen so far
+
+    static void reset();
+
+    // Start a new frame, completing any frame already open
+    static void frame(const render_screen_t screen, const bool full);
+
+    // Time spent drawing or sending the open frame
+    static void begin();
+    static void end();
+
+    // Data sent to the display for the open frame
+    static void feed(const void * const data, const uint16_t len);
+    static void feed(const uint16_t value, const uint32_t repeat);
+    static void unsent(const uint16_t len) { if (open) cur.bytes -= len; }
+
+    // Complete the open frame so it can be reported
+    static void close();
+
+  private:
+    static render_screen_stats_t cur;
+    static uint32_t start_us;
+    static uint16_t crc;
+    static bool open;
+};
@@ -44,11 +44,13 @@ void Canvas::instantiate(uint16_t x, uint16_t y, uint16_t width, uint16_t height
 
 void Canvas::next() {
   startLine = endLine;
-  endLine = (TFT_BUFFER_WORDS) < width * (height - startLine) ? startLine + (TFT_BUFFER_WORDS) / width : height;
+  endLine = (CANVAS_BUFFER_WORDS) < width * (height - startLine) ? startLine + (CANVAS_BUFFER_WORDS) / width : height;
 }
 
 bool Canvas::toScreen() {
   tft.write_sequence(buffer, width * (endLine - startLine));
+  // Draw the next band in the other half while this one is sent
+  TERN_(TFT_DOUBLE_BUFFER, buffer = (buffer == TFT::buffer) ? TFT::buffer + (CANVAS_BUFFER_WORDS) : TFT::buffer);
   return endLine == height;
 }
 
@@ -85,18 +87,170 @@ void Canvas::addText(uint16_t x, uint16_t y, uint16_t color, uint16_t *string, u
   for (uint16_t i = 0 ; *(string + i) ; i++) {
     glyph_t *pGlyph = glyph(string + i);
     if (stringWidth + pGlyph->bbxWidth > maxWidth) break;
+    const int16_t glyphX = x + stringWidth + pGlyph->bbxOffsetX,
+                  glyphY = y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY;
+    stringWidth += pGlyph->dWidth;
+
+    #if ENABLED(TFT_GLYPH_CACHE)
+      const uint16_t *runs = cachedGlyph(pGlyph, color, getFontType() == FONT_MARLIN_GLYPHS_2BPP ? colors : &color);
+      if (runs) {
+        addGlyphRuns(glyphX, glyphY, pGlyph->bbxHeight, runs);
+        continue;
+      }
+    #endif
+
     switch (getFontType()) {
       case FONT_MARLIN_GLYPHS_1BPP:
-        addImage(x + stringWidth + pGlyph->bbxOffsetX, y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY, pGlyph->bbxWidth, pGlyph->bbxHeight, GREYSCALE1, ((uint8_t *)pGlyph) + sizeof(glyph_t), &color);
+        addImage(glyphX, glyphY, pGlyph->bbxWidth, pGlyph->bbxHeight, GREYSCALE1, ((uint8_t *)pGlyph) + sizeof(glyph_t), &color);
         break;
       case FONT_MARLIN_GLYPHS_2BPP:
-        addImage(x + stringWidth + pGlyph->bbxOffsetX, y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY, pGlyph->bbxWidth, pGlyph->bbxHeight, GREYSCALE2, ((uint8_t *)pGlyph) + sizeof(glyph_t), colors);
+        addImage(glyphX, glyphY, pGlyph->bbxWidth, pGlyph->bbxHeight, GREYSCALE2, ((uint8_t *)pGlyph) + sizeof(glyph_t), colors);
         break;
     }
-    stringWidth += pGlyph->dWidth;
   }
 }
 
+#if ENABLED(TFT_GLYPH_CACHE)
+
+  cachedGlyph_t Canvas::glyphCache[TFT_GLYPH_CACHE_GLYPHS];
+  uint16_t Canvas::glyphPool[GLYPH_POOL_WORDS], Canvas::glyphPoolUsed;
+  uint32_t Canvas::glyphClock;
+
+  /**
+   * Get the pixel runs for a glyph in the given colors, rendering it into
+   * the cache on a miss. Return nullptr if the glyph can't be cached.
+   * The result is only valid until the next call.
+   */
+  const uint16_t *Canvas::cachedGlyph(const glyph_t *pGlyph, const uint16_t color, const uint16_t *colors) {
+    const uint16_t type = getFontType();
+    if (type != FONT_MARLIN_GLYPHS_1BPP && type != FONT_MARLIN_GLYPHS_2BPP) return nullptr;
+
+    // Anti-aliased pixels are blended with the background
+    const uint16_t background = type == FONT_MARLIN_GLYPHS_2BPP ? background_color : 0;
+
+    ++glyphClock;
+    for (cachedGlyph_t &entry : glyphCache) {
+      if (entry.glyph == pGlyph && entry.color == color && entry.background == background) {
+        entry.used = glyphClock;
+        return glyphPool + entry.offset;
+      }
+    }
+
+    const uint16_t words = glyphRuns(pGlyph, colors);
+    if (words > GLYPH_POOL_WORDS) return nullptr;
+
+    // Make room by dropping the least recently used glyphs
+    while (GLYPH_POOL_WORDS - glyphPoolUsed < words) dropGlyph(staleGlyph(true));
+    const uint8_t index = staleGlyph(false);
+    dropGlyph(index);
+
+    cachedGlyph_t &entry = glyphCache[index];
+    entry.glyph = pGlyph;
+    entry.color = color;
+    entry.background = background;
+    entry.offset = glyphPoolUsed;
+    entry.words = words;
+    entry.used = glyphClock;
+    glyphPoolUsed += words;
+
+    uint16_t * const runs = glyphPool + entry.offset;
+    glyphRuns(pGlyph, colors, runs);
+    return runs;
+  }
+
+  // Encode a 1bpp or 2bpp glyph as pixel runs. With no output just count the words.
+  uint16_t Canvas::glyphRuns(const glyph_t *pGlyph, const uint16_t *colors, uint16_t *runs/*=nullptr*/) {
+    const uint8_t bitsPerPixel = getFontType() == FONT_MARLIN_GLYPHS_2BPP ? 2 : 1,
+                  mask = 0xFF >> (8 - bitsPerPixel);
+    const uint8_t *data = ((const uint8_t *)pGlyph) + sizeof(glyph_t);
+
+    uint16_t words = 0, run = 0;
+    for (uint8_t i = 0; i < pGlyph->bbxHeight; i++) {
+      uint8_t skip = 0;
+      int8_t offset = 8 - bitsPerPixel;
+      bool in_run = false;
+      for (uint8_t j = 0; j < pGlyph->bbxWidth; j++) {
+        if (offset < 0) {
+          data++;
+          offset = 8 - bitsPerPixel;
+        }
+        const uint8_t pixel = ((*data) >> offset) & mask;
+        offset -= bitsPerPixel;
+        if (!pixel) {
+          in_run = false;
+          skip++;
+          continue;
+        }
+        if (!in_run) {
+          in_run = true;
+          run = words++;
+          if (runs) runs[run] = skip << 8;
+          skip = 0;
+        }
+        if (runs) {
+          runs[words] = colors[pixel - 1];
+          runs[run]++;
+        }
+        words++;
+      }
+      data++;
+      if (runs) runs[words] = 0;
+      words++;
+    }
+    return words;
+  }
+
+  // The least recently used glyph. Unless 'live' is set an unused entry is preferred.
+  uint8_t Canvas::staleGlyph(const bool live) {
+    uint8_t stale = 0;
+    uint32_t stale_age = 0;
+    for (uint8_t i = 0; i < TFT_GLYPH_CACHE_GLYPHS; i++) {
+      const cachedGlyph_t &entry = glyphCache[i];
+      if (!entry.glyph) {
+        if (!live) return i;
+        continue;
+      }
+      const uint32_t age = glyphClock - entry.used;
+      if (age >= stale_age) { stale = i; stale_age = age; }
+    }
+    return stale;
+  }
+
+  // Remove a glyph and close the gap it leaves in the pool
+  void Canvas::dropGlyph(const uint8_t index) {
+    cachedGlyph_t &entry = glyphCache[index];
+    if (!entry.glyph) return;
+    const uint16_t end = entry.offset + entry.words;
+    memmove(glyphPool + entry.offset, glyphPool + end, (glyphPoolUsed - end) * sizeof(uint16_t));
+    for (cachedGlyph_t &other : glyphCache)
+      if (other.glyph && other.offset > entry.offset) other.offset -= entry.words;
+    glyphPoolUsed -= entry.words;
+    entry.glyph = nullptr;
+  }
+
+  void Canvas::addGlyphRuns(int16_t x, int16_t y, uint8_t rows, const uint16_t *runs) {
+    for (int16_t line = y; line < y + rows; line++) {
+      if (line >= endLine) return;
+      uint16_t * const row = WITHIN(line, startLine, endLine - 1) ? buffer + (line - startLine) * width : nullptr;
+      int16_t cx = x;
+      for (uint16_t run; (run = *runs++);) {
+        const uint8_t count = run & 0xFF;
+        cx += run >> 8;
+        if (row) {
+          if (cx >= 0 && cx + count <= width)
+            memcpy(row + cx, runs, count * sizeof(uint16_t));
+          else
+            for (uint8_t j = 0; j < count; j++)
+              if (WITHIN(cx + j, 0, width - 1)) row[cx + j] = runs[j];
+        }
+        runs += count;
+        cx += count;
+      }
+    }
+  }
+
+#endif // TFT_GLYPH_CACHE
+
 void Canvas::addImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
   uint16_t *data = (uint16_t *)images[image].data;
   if (!data) return;
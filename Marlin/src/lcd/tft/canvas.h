@@ -27,6 +27,29 @@
 
 #include "../../inc/MarlinConfig.h"
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  // One half is drawn while the other half is sent by DMA
+  #define CANVAS_BUFFER_WORDS ((TFT_BUFFER_WORDS) / 2)
+#else
+  #define CANVAS_BUFFER_WORDS (TFT_BUFFER_WORDS)
+#endif
+
+#if ENABLED(TFT_GLYPH_CACHE)
+  #define GLYPH_POOL_WORDS ((TFT_GLYPH_CACHE_SIZE) / 2)
+
+  /**
+   * A glyph rendered with its final colors, stored in the pool as pixel runs.
+   * Each row is a list of (skip << 8 | count) words, each followed by count
+   * RGB565 pixels, and ends with a 0 word. Skipped pixels are transparent.
+   */
+  typedef struct {
+    const glyph_t *glyph;       // Font glyph, unique for each font and character
+    uint16_t color, background; // Colors the glyph was rendered with
+    uint16_t offset, words;     // Location in the pool
+    uint32_t used;              // Cache clock at the last use
+  } cachedGlyph_t;
+#endif
+
 class Canvas {
   private:
     static uint16_t background_color;
@@ -34,6 +57,18 @@ class Canvas {
     static uint16_t startLine, endLine;
     static uint16_t *buffer;
 
+    #if ENABLED(TFT_GLYPH_CACHE)
+      static cachedGlyph_t glyphCache[TFT_GLYPH_CACHE_GLYPHS];
+      static uint16_t glyphPool[GLYPH_POOL_WORDS], glyphPoolUsed;
+      static uint32_t glyphClock;
+
+      static const uint16_t *cachedGlyph(const glyph_t *pGlyph, const uint16_t color, const uint16_t *colors);
+      static uint16_t glyphRuns(const glyph_t *pGlyph, const uint16_t *colors, uint16_t *runs=nullptr);
+      static uint8_t staleGlyph(const bool live);
+      static void dropGlyph(const uint8_t index);
+      static void addGlyphRuns(int16_t x, int16_t y, uint8_t rows, const uint16_t *runs);
+    #endif
+
     inline static glyph_t *glyph(uint16_t *character) { return TFT_String::glyph(character); }
     inline static uint16_t getFontType() { return TFT_String::font_type(); }
     inline static uint16_t getFontAscent() { return TFT_String::font_ascent(); }
@@ -46,6 +81,7 @@ class Canvas {
     static void instantiate(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
     static void next();
     static bool toScreen();
+    static uint32_t bandBytes() { return uint32_t(width) * (endLine - startLine) * sizeof(uint16_t); }
 
     static void setBackground(uint16_t color);
     static void addText(uint16_t x, uint16_t y, uint16_t color, uint16_t *string, uint16_t maxWidth);
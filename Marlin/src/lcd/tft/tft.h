@@ -30,6 +30,10 @@
 
 #include "../../inc/MarlinConfig.h"
 
+#if ENABLED(UI_RENDER_STATS)
+  #include "../render_stats.h"
+#endif
+
 #if ENABLED(TFT_INTERFACE_FSMC_8BIT)
   // When we have a 8 bit interface, we need to invert the bytes of the color
   #define ENDIAN_COLOR(C) (((C) >> 8) | ((C) << 8))
@@ -54,6 +58,10 @@
   #error "TFT_BUFFER_WORDS can not exceed DMA_MAX_WORDS"
 #endif
 
+#if ENABLED(TFT_DOUBLE_BUFFER) && (TFT_BUFFER_WORDS) / 2 < TFT_WIDTH
+  #error "TFT_DOUBLE_BUFFER requires TFT_BUFFER_WORDS to hold at least one full display line in each half."
+#endif
+
 class TFT {
   private:
     static TFT_String string;
@@ -70,8 +78,14 @@ class TFT {
 
     static bool is_busy() { return io.isBusy(); }
     static void abort() { io.abort(); }
-    static void write_multiple(uint16_t data, uint16_t count) { io.WriteMultipleDMA(data, count); }
-    static void write_sequence(uint16_t *data, uint16_t count) { io.writeSequenceDMA(data, count); }
+    static void write_multiple(uint16_t data, uint16_t count) {
+      TERN_(UI_RENDER_STATS, RenderStats::feed(data, count));
+      io.WriteMultipleDMA(data, count);
+    }
+    static void write_sequence(uint16_t *data, uint16_t count) {
+      TERN_(UI_RENDER_STATS, RenderStats::feed(data, count * 2));
+      io.writeSequenceDMA(data, count);
+    }
     static void set_window(uint16_t xMin, uint16_t yMin, uint16_t xMax, uint16_t yMax) { io.set_window(xMin, yMin, xMax, yMax); }
 
     static void fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) { queue.fill(x, y, width, height, color); }
@@ -34,6 +34,12 @@ uint8_t *TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  bool TFT_Queue::band_ready; // = false
+  uint32_t TFT_Queue::frame_start_us, TFT_Queue::frame_bytes;
+  tft_queue_stats_t TFT_Queue::stats; // = { 0 }
+#endif
+
 void TFT_Queue::reset() {
   tft.abort();
 
@@ -58,7 +64,10 @@ void TFT_Queue::async() {
   finish_sketch();
 
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE:
+      TERN_(TFT_DOUBLE_BUFFER, frame_done());
+      reset();
+      break;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
@@ -73,10 +82,30 @@ void TFT_Queue::finish_sketch() {
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
 
-    if (!current_task) current_task = (uint8_t *)task;
+    if (!current_task) first_task(task);
   }
 }
 
+void TFT_Queue::first_task(queueTask_t *task) {
+  current_task = (uint8_t *)task;
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    frame_start_us = micros();
+    frame_bytes = 0;
+  #endif
+}
+
+#if ENABLED(TFT_DOUBLE_BUFFER)
+
+  // The queue has run dry, so the screen update is on the display
+  void TFT_Queue::frame_done() {
+    stats.frames++;
+    stats.frame_us = micros() - frame_start_us;
+    NOLESS(stats.max_frame_us, stats.frame_us);
+    stats.frame_bytes = frame_bytes;
+  }
+
+#endif
+
 void TFT_Queue::fill(queueTask_t *task) {
   uint16_t count;
   parametersFill_t *task_parameters = (parametersFill_t *)(((uint8_t *)task) + sizeof(queueTask_t));
@@ -96,19 +125,39 @@ void TFT_Queue::fill(queueTask_t *task) {
     task->state = TASK_STATE_COMPLETED;
   }
 
+  TERN_(TFT_DOUBLE_BUFFER, frame_bytes += count * sizeof(uint16_t));
   tft.write_multiple(task_parameters->color, count);
 }
 
 void TFT_Queue::canvas(queueTask_t *task) {
   parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
 
-  uint16_t i;
-  uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
-
   if (task->state == TASK_STATE_READY) {
     task->state = TASK_STATE_IN_PROGRESS;
     tftCanvas.instantiate(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
+    TERN_(TFT_DOUBLE_BUFFER, band_ready = false);
   }
+
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    if (!band_ready) draw_band(task_parameters);
+    frame_bytes += tftCanvas.bandBytes();
+    if (tftCanvas.toScreen()) {
+      task->state = TASK_STATE_COMPLETED;
+      return;
+    }
+    // Draw the next band while DMA sends this one. It goes out on the next call.
+    draw_band(task_parameters);
+    band_ready = true;
+  #else
+    draw_band(task_parameters);
+    if (tftCanvas.toScreen()) task->state = TASK_STATE_COMPLETED;
+  #endif
+}
+
+void TFT_Queue::draw_band(parametersCanvas_t *task_parameters) {
+  uint16_t i;
+  uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
+
   tftCanvas.next();
 
   for (i = 0; i < task_parameters->count; i++) {
@@ -139,7 +188,6 @@ void TFT_Queue::canvas(queueTask_t *task) {
     item = ((parametersCanvasBackground_t *)item)->nextParameter;
   }
 
-  if (tftCanvas.toScreen()) task->state = TASK_STATE_COMPLETED;
 }
 
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -165,7 +213,7 @@ void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ui
   task->state = TASK_STATE_READY;
   task->type = TASK_FILL;
 
-  if (!current_task) current_task = (uint8_t *)task;
+  if (!current_task) first_task(task);
 }
 
 void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
@@ -189,7 +237,7 @@ void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
   task_parameters->height = height;
   task_parameters->count = 0;
 
-  if (!current_task) current_task = (uint8_t *)task;
+  if (!current_task) first_task(task);
 }
 
 void TFT_Queue::set_background(uint16_t color) {
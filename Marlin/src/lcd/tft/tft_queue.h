@@ -118,6 +118,14 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  typedef struct {
+    uint32_t frames;                // Screen updates sent
+    uint32_t frame_us, max_frame_us; // Time from queueing to the last pixel sent, for the last and slowest update
+    uint32_t frame_bytes;           // Data sent in the last update
+  } tft_queue_stats_t;
+#endif
+
 class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
@@ -127,11 +135,23 @@ class TFT_Queue {
     static uint8_t *last_parameter;
 
     static void finish_sketch();
+    static void first_task(queueTask_t *task);
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
+    static void draw_band(parametersCanvas_t *task_parameters);
     static void handle_queue_overflow(uint16_t sizeNeeded);
 
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static bool band_ready;
+      static uint32_t frame_start_us, frame_bytes;
+      static void frame_done();
+    #endif
+
   public:
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static tft_queue_stats_t stats;
+    #endif
+
     static void reset();
     static void async();
     static void sync() { while (current_task != nullptr) async(); }
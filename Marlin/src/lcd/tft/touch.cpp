@@ -38,6 +38,10 @@
 
 #include "tft.h"
 
+#if ENABLED(TOUCH_ISR_SAMPLING)
+  #include "../touch/touch_sampler.h"
+#endif
+
 Touch touch;
 
 bool Touch::enabled = true;
@@ -53,6 +57,10 @@ TouchControlType Touch::touch_control_type = NONE;
 #if HAS_DISPLAY_SLEEP
   millis_t Touch::next_sleep_ms; // = 0
 #endif
+#if ENABLED(UI_RENDER_STATS)
+  int16_t Touch::script_x, Touch::script_y;
+  bool Touch::script_pressed; // = false
+#endif
 #if HAS_RESUME_CONTINUE
   extern bool wait_for_user;
 #endif
@@ -60,7 +68,7 @@ TouchControlType Touch::touch_control_type = NONE;
 void Touch::init() {
   TERN_(TOUCH_SCREEN_CALIBRATION, touch_calibration.calibration_reset());
   reset();
-  io.init();
+  TERN(TOUCH_ISR_SAMPLING, touchSampler.init(), io.init());
   TERN_(HAS_DISPLAY_SLEEP, wakeUp());
   enable();
 }
@@ -91,6 +99,7 @@ void Touch::idle() {
     #if HAS_RESUME_CONTINUE
       // UI is waiting for a click anywhere?
       if (wait_for_user) {
+        TERN_(UI_RENDER_STATS, script_pressed = false);
         touch_control_type = CLICK;
         ui.lcd_clicked = true;
         if (ui.external_control) wait_for_user = false;
@@ -108,9 +117,13 @@ void Touch::idle() {
       return;
     }
 
-    if (time_to_hold == 0) time_to_hold = now + MINIMUM_HOLD_TIME;
+    // Sampled presses are already debounced
+    if (time_to_hold == 0) time_to_hold = now + TERN(TOUCH_ISR_SAMPLING, 0, MINIMUM_HOLD_TIME);
     if (PENDING(now, time_to_hold)) return;
 
+    // A queued tap may be seen only once, so take its position right away
+    TERN_(TOUCH_ISR_SAMPLING, if (x == 0 && y == 0) { x = _x; y = _y; })
+
     if (x != 0 && y != 0) {
       if (current_control) {
         if (WITHIN(x, current_control->x - FREE_MOVE_RANGE, current_control->x + current_control->width + FREE_MOVE_RANGE) && WITHIN(y, current_control->y - FREE_MOVE_RANGE, current_control->y + current_control->height + FREE_MOVE_RANGE)) {
@@ -133,6 +146,8 @@ void Touch::idle() {
 
       if (!current_control)
         touch_time = now;
+
+      TERN_(UI_RENDER_STATS, script_pressed = false); // Release a scripted tap once it has been handled
     }
     x = _x;
     y = _y;
@@ -265,7 +280,12 @@ void Touch::hold(touch_control_t *control, millis_t delay) {
 }
 
 bool Touch::get_point(int16_t * const x, int16_t * const y) {
-  #if ANY(TFT_TOUCH_DEVICE_XPT2046, TFT_TOUCH_DEVICE_GT911)
+  #if ENABLED(UI_RENDER_STATS)
+    if (script_pressed) { *x = script_x; *y = script_y; return true; }
+  #endif
+  #if ENABLED(TOUCH_ISR_SAMPLING)
+    const bool is_touched = TOUCH_PORTRAIT == _TOUCH_ORIENTATION ? touchSampler.get_point(y, x) : touchSampler.get_point(x, y);
+  #elif ANY(TFT_TOUCH_DEVICE_XPT2046, TFT_TOUCH_DEVICE_GT911)
     const bool is_touched = TOUCH_PORTRAIT == _TOUCH_ORIENTATION ? io.getRawPoint(y, x) : io.getRawPoint(x, y);
   #endif
   #if ENABLED(TFT_TOUCH_DEVICE_XPT2046)
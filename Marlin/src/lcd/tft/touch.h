@@ -110,6 +110,12 @@ class Touch {
       static void sleepTimeout();
       static void wakeUp();
     #endif
+    #if ENABLED(UI_RENDER_STATS)
+      // A tap from M257 X Y, held until it has been handled
+      static int16_t script_x, script_y;
+      static bool script_pressed;
+      static void script_tap(const int16_t sx, const int16_t sy) { script_x = sx; script_y = sy; script_pressed = true; }
+    #endif
     static void add_control(TouchControlType type, uint16_t x, uint16_t y, uint16_t width, uint16_t height, intptr_t data=0);
     static void add_control(TouchControlType type, uint16_t x, uint16_t y, uint16_t width, uint16_t height, void (*handler)()) {
       add_control(type, x, y, width, height, intptr_t(handler));
@@ -36,6 +36,10 @@
 #include "../../module/planner.h"
 #include "../../module/motion.h"
 
+#if ENABLED(UI_RENDER_STATS)
+  #include "../render_stats.h"
+#endif
+
 #if DISABLED(LCD_PROGRESS_BAR) && ALL(FILAMENT_LCD_DISPLAY, HAS_MEDIA)
   #include "../../feature/filwidth.h"
   #include "../../gcode/parser.h"
@@ -56,7 +60,16 @@ void MarlinUI::tft_idle() {
     }
   #endif
 
-  tft.queue.async();
+  // Send the next band of the screen, unless the planner is about to run dry
+  #if ENABLED(UI_PLANNER_BUDGET)
+    static ui_deferral_t band_deferral; // = { false }
+    if (budget_allows(millis(), 1, band_deferral))
+  #endif
+  {
+    TERN_(UI_RENDER_STATS, RenderStats::begin()); // Count only the sending in the frame time
+    tft.queue.async();
+    TERN_(UI_RENDER_STATS, RenderStats::end());
+  }
 
   TERN_(TOUCH_SCREEN, if (tft.queue.is_empty()) touch.idle()); // Touch driver is not DMA-aware, so only check for touch controls after screen drawing is completed
 }
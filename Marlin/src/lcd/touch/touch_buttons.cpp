@@ -46,6 +46,10 @@
 #include "../tft_io/tft_io.h"
 #include "../tft_io/touch_calibration.h"
 
+#if ENABLED(TOUCH_ISR_SAMPLING)
+  #include "touch_sampler.h"
+#endif
+
 #define DOGM_AREA_LEFT   TFT_PIXEL_OFFSET_X
 #define DOGM_AREA_TOP    TFT_PIXEL_OFFSET_Y
 #define DOGM_AREA_WIDTH  (GRAPHICAL_TFT_UPSCALE) * (LCD_PIXEL_WIDTH)
@@ -57,7 +61,7 @@
 TouchButtons touchBt;
 
 void TouchButtons::init() {
-  touchIO.init();
+  TERN(TOUCH_ISR_SAMPLING, touchSampler.init(), touchIO.init());
   #if HAS_DISPLAY_SLEEP
     next_sleep_ms = ui.sleep_timeout_minutes ? millis() + MIN_TO_MS(ui.sleep_timeout_minutes) : 0;
   #endif
@@ -70,8 +74,8 @@ uint8_t TouchButtons::read_buttons() {
     #if ENABLED(TFT_TOUCH_DEVICE_XPT2046)
 
       const bool is_touched = TOUCH_PORTRAIT == _TOUCH_ORIENTATION
-                                ? touchIO.getRawPoint(&y, &x)
-                                : touchIO.getRawPoint(&x, &y);
+                                ? TERN(TOUCH_ISR_SAMPLING, touchSampler.get_point(&y, &x), touchIO.getRawPoint(&y, &x))
+                                : TERN(TOUCH_ISR_SAMPLING, touchSampler.get_point(&x, &y), touchIO.getRawPoint(&x, &y));
       #if HAS_DISPLAY_SLEEP
         if (is_touched)
           wakeUp();
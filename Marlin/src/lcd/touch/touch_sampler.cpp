@@ -0,0 +1,166 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(TOUCH_ISR_SAMPLING)
+
+#include "touch_sampler.h"
+#include HAL_PATH(../.., tft/xpt2046.h)
+
+TouchSampler touchSampler;
+
+bool TouchSampler::active; // = false
+uint8_t TouchSampler::phase, TouchSampler::index, TouchSampler::count;
+bool TouchSampler::down, TouchSampler::pending;
+int16_t TouchSampler::sx[3], TouchSampler::sy[3];
+int32_t TouchSampler::fx, TouchSampler::fy;
+int16_t TouchSampler::ex, TouchSampler::ey;
+touch_event_t TouchSampler::queue[TOUCH_EVENT_QUEUE];
+volatile uint8_t TouchSampler::head, TouchSampler::tail;
+touch_event_t TouchSampler::last; // = { TOUCH_RELEASE }
+
+static int16_t median3(const int16_t a, const int16_t b, const int16_t c) {
+  return _MAX(_MIN(a, b), _MIN(_MAX(a, b), c));
+}
+
+void TouchSampler::init() {
+  active = false;
+  XPT2046::init();
+  phase = index = count = 0;
+  down = pending = false;
+  head = tail = 0;
+  last.type = TOUCH_RELEASE;
+  active = true;
+}
+
+void TouchSampler::sample() {
+  if (!active) return;
+
+  switch (phase) {
+    case 0: {
+      #if PIN_EXISTS(TOUCH_INT)
+        const bool pressed = XPT2046::isTouched();
+      #else
+        // Release at a lower pressure than press so light touches don't chatter
+        const bool pressed = XPT2046::getRawData(XPT2046_Z1) >= (down ? _MAX((XPT2046_Z1_THRESHOLD) / 2, 1) : (XPT2046_Z1_THRESHOLD));
+      #endif
+
+      if (!pressed) {
+        // X and Y read while the finger was lifting are unreliable, so drop them
+        pending = false;
+        count = 0;
+        if (down) {
+          down = false;
+          push(TOUCH_RELEASE);
+        }
+        return;
+      }
+
+      // Still pressed, so the previous X and Y are good
+      if (pending) {
+        pending = false;
+        apply();
+      }
+      phase = 1;
+    } break;
+
+    case 1:
+      sx[index] = XPT2046::getRawData(XPT2046_X);
+      phase = 2;
+      break;
+
+    case 2:
+      sy[index] = XPT2046::getRawData(XPT2046_Y);
+      if (++index >= COUNT(sx)) index = 0;
+      if (count < 255) count++;
+      pending = true;
+      phase = 0;
+      break;
+  }
+}
+
+void TouchSampler::apply() {
+  if (!down && count < TOUCH_SAMPLE_DEBOUNCE) return;
+
+  const int16_t mx = median3(sx[0], sx[1], sx[2]),
+                my = median3(sy[0], sy[1], sy[2]);
+
+  if (!down) {
+    // Start the filter at the first good position so it doesn't drag in from the last touch
+    down = true;
+    fx = int32_t(mx) << (TOUCH_IIR_SHIFT);
+    fy = int32_t(my) << (TOUCH_IIR_SHIFT);
+    ex = mx;
+    ey = my;
+    push(TOUCH_PRESS);
+    return;
+  }
+
+  fx += mx - (fx >> (TOUCH_IIR_SHIFT));
+  fy += my - (fy >> (TOUCH_IIR_SHIFT));
+  const int16_t nx = fx >> (TOUCH_IIR_SHIFT), ny = fy >> (TOUCH_IIR_SHIFT);
+  if (nx != ex || ny != ey) {
+    ex = nx;
+    ey = ny;
+    push(TOUCH_MOVE);
+  }
+}
+
+void TouchSampler::push(const TouchEventType type) {
+  const uint8_t h = head,
+                prev = (h + TOUCH_EVENT_QUEUE - 1) % (TOUCH_EVENT_QUEUE),
+                used = (h + TOUCH_EVENT_QUEUE - tail) % (TOUCH_EVENT_QUEUE);
+
+  // Update a queued move instead of adding another. Never the one at the tail,
+  // which the UI may be reading.
+  if (type == TOUCH_MOVE && used >= 2 && queue[prev].type == TOUCH_MOVE) {
+    queue[prev].x = ex;
+    queue[prev].y = ey;
+    return;
+  }
+
+  // When full, replace the newest event so the final state is still correct
+  if (used >= (TOUCH_EVENT_QUEUE) - 1) {
+    if (type != TOUCH_MOVE) queue[prev] = { type, ex, ey };
+    return;
+  }
+
+  queue[h] = { type, ex, ey };
+  head = (h + 1) % (TOUCH_EVENT_QUEUE);
+}
+
+bool TouchSampler::get_point(int16_t * const x, int16_t * const y) {
+  // Skip over queued moves, but stop at a press or release so no tap is lost
+  uint8_t t = tail;
+  while (t != head) {
+    last = queue[t];
+    t = (t + 1) % (TOUCH_EVENT_QUEUE);
+    if (last.type != TOUCH_MOVE) break;
+  }
+  tail = t;
+  *x = last.x;
+  *y = last.y;
+  return last.type != TOUCH_RELEASE;
+}
+
+#endif // TOUCH_ISR_SAMPLING
@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * lcd/touch/touch_sampler.h
+ *
+ * XPT2046 sampling from the Temperature ISR. One channel is read per call, so
+ * a full Z1/X/Y sample takes three calls. Samples are debounced, median and
+ * IIR filtered, and handed to the UI as press, move and release events.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+enum TouchEventType : uint8_t { TOUCH_RELEASE, TOUCH_PRESS, TOUCH_MOVE };
+
+typedef struct {
+  TouchEventType type;
+  int16_t x, y;       // Raw filtered panel coordinates
+} touch_event_t;
+
+class TouchSampler {
+  public:
+    static void init();
+
+    // Called from the Temperature ISR
+    static void sample();
+
+    // Catch up to the newest queued position, stopping at a press or release.
+    // Returns true while the panel is pressed.
+    static bool get_point(int16_t * const x, int16_t * const y);
+
+  private:
+    static bool active;
+
+    // Sampling state, only touched by the ISR
+    static uint8_t phase, index, count;
+    static bool down, pending;
+    static int16_t sx[3], sy[3];
+    static int32_t fx, fy;            // IIR accumulators, scaled by (1 << TOUCH_IIR_SHIFT)
+    static int16_t ex, ey;            // Last queued position
+
+    static void apply();
+    static void push(const TouchEventType type);
+
+    // Single producer (ISR), single consumer (UI) event ring
+    static touch_event_t queue[TOUCH_EVENT_QUEUE];
+    static volatile uint8_t head, tail;
+    static touch_event_t last;
+};
+
+extern TouchSampler touchSampler;
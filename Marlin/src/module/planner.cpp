@@ -213,6 +213,10 @@ uint32_t Planner::max_acceleration_steps_per_s2[DISTINCT_AXES]; // (steps/s^2) D
 
 #if ENABLED(AUTOTEMP)
   autotemp_t Planner::autotemp = { AUTOTEMP_MIN, AUTOTEMP_MAX, AUTOTEMP_FACTOR, false };
+  #if ENABLED(AUTOTEMP_VOLUMETRIC)
+    celsius_t Planner::autotemp_curve[AUTOTEMP_MATERIALS][AUTOTEMP_FLOW_COUNT] = AUTOTEMP_FLOW_CURVES;
+    uint8_t Planner::autotemp_material; // = 0
+  #endif
 #endif
 
 // private:
@@ -1378,22 +1382,82 @@ void Planner::check_axes_activity() {
     if (!autotemp.enabled) return;
     if (thermalManager.degTargetHotend(active_extruder) < autotemp.min - 2) return; // Below the min?
 
-    float high = 0.0f;
-    for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
-      const block_t * const block = &block_buffer[b];
-      if (NUM_AXIS_GANG(block->steps.x, || block->steps.y, || block->steps.z, || block->steps.i, || block->steps.j, || block->steps.k, || block->steps.u, || block->steps.v, || block->steps.w)) {
-        const float se = float(block->steps.e) / block->step_event_count * block->nominal_speed; // mm/sec
-        NOLESS(high, se);
+    #if ENABLED(AUTOTEMP_VOLUMETRIC)
+      float t = autotemp.min + autotemp_boost(autotemp_flow()) * autotemp.factor;
+    #else
+      float high = 0.0f;
+      for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+        const block_t * const block = &block_buffer[b];
+        if (NUM_AXIS_GANG(block->steps.x, || block->steps.y, || block->steps.z, || block->steps.i, || block->steps.j, || block->steps.k, || block->steps.u, || block->steps.v, || block->steps.w)) {
+          const float se = float(block->steps.e) / block->step_event_count * block->nominal_speed; // mm/sec
+          NOLESS(high, se);
+        }
       }
-    }
 
-    float t = autotemp.min + high * autotemp.factor;
+      float t = autotemp.min + high * autotemp.factor;
+    #endif
     LIMIT(t, autotemp.min, autotemp.max);
     if (t < oldt) t = t * (1.0f - (AUTOTEMP_OLDWEIGHT)) + oldt * (AUTOTEMP_OLDWEIGHT);
     oldt = t;
     thermalManager.setTargetHotend(t, active_extruder);
   }
 
+  #if ENABLED(AUTOTEMP_VOLUMETRIC)
+
+    static_assert(AUTOTEMP_FLOW_COUNT >= 2, "AUTOTEMP_FLOW_POINTS must have at least 2 points.");
+
+    void Planner::autotemp_reset_curves() {
+      COPY(autotemp_curve, autotemp_flow_curves_defaults);
+      autotemp_material = 0;
+    }
+
+    /**
+     * Average volumetric flow (mm^3/s) of the active extruder over the
+     * first AUTOTEMP_FLOW_WINDOW seconds of queued moves. Travel and
+     * retraction count as time with no flow, so a short burst of fast
+     * extrusion isn't taken for a sustained one.
+     */
+    float Planner::autotemp_flow() {
+      float time = 0.0f, e_mm = 0.0f;
+      for (uint8_t b = block_buffer_tail; b != block_buffer_head && time < (AUTOTEMP_FLOW_WINDOW); b = next_block_index(b)) {
+        block_t * const block = &block_buffer[b];
+        if (!block->is_move() || block->nominal_speed <= 0.0f) continue;
+
+        const float block_time = block->millimeters / block->nominal_speed,
+                    part = _MIN(1.0f, ((AUTOTEMP_FLOW_WINDOW) - time) / block_time);  // Part of the block inside the window
+        time += block_time * part;
+
+        if (block->extruder == active_extruder && block->direction_bits.e)
+          e_mm += block->steps.e * mm_per_step[E_AXIS_N(block->extruder)] * part;
+      }
+      if (time <= 0.0f) return 0.0f;
+
+      #if DISABLED(NO_VOLUMETRICS)
+        const float dia = filament_size[active_extruder] ? filament_size[active_extruder] : DEFAULT_NOMINAL_FILAMENT_DIA;
+      #else
+        constexpr float dia = DEFAULT_NOMINAL_FILAMENT_DIA;
+      #endif
+      return e_mm * CIRCLE_AREA(dia * 0.5f) / time;
+    }
+
+    /**
+     * Interpolate the active material's curve at the given flow (mm^3/s).
+     * Flow beyond the last point gets the last point's boost.
+     */
+    celsius_float_t Planner::autotemp_boost(const_float_t flow) {
+      const celsius_t * const boost = autotemp_curve[autotemp_material];
+      if (flow <= autotemp_flow_points[0]) return boost[0];
+      for (uint8_t i = 1; i < AUTOTEMP_FLOW_COUNT; ++i) {
+        if (flow < autotemp_flow_points[i]) {
+          const float f0 = autotemp_flow_points[i - 1];
+          return boost[i - 1] + (boost[i] - boost[i - 1]) * (flow - f0) / (autotemp_flow_points[i] - f0);
+        }
+      }
+      return boost[AUTOTEMP_FLOW_COUNT - 1];
+    }
+
+  #endif // AUTOTEMP_VOLUMETRIC
+
 #endif // AUTOTEMP
 
 #if DISABLED(NO_VOLUMETRICS)
@@ -2932,6 +2996,11 @@ bool Planner::buffer_segment(const abce_pos_t &abce
     #endif
   //*/
 
+  #if ENABLED(HEATUP_AND_CONTINUE)
+    // Finish a deferred M109 / M190 before any extruding move
+    if (target.e > position.e) thermalManager.finish_deferred_heatup(extruder);
+  #endif
+
   // Queue the movement. Return 'false' if the move was not queued.
   if (!_buffer_steps(target
       OPTARG(HAS_POSITION_FLOAT, target_float)
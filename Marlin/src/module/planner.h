@@ -166,6 +166,13 @@ typedef struct {
     float factor;
     bool enabled;
   } autotemp_t;
+
+  #if ENABLED(AUTOTEMP_VOLUMETRIC)
+    constexpr float autotemp_flow_points[] = AUTOTEMP_FLOW_POINTS;  // (mm^3/s) Flow at each curve point
+    #define AUTOTEMP_FLOW_COUNT COUNT(autotemp_flow_points)
+    constexpr celsius_t autotemp_flow_curves_defaults[][AUTOTEMP_FLOW_COUNT] = AUTOTEMP_FLOW_CURVES;
+    #define AUTOTEMP_MATERIALS COUNT(autotemp_flow_curves_defaults)
+  #endif
 #endif
 
 #if ENABLED(LASER_FEATURE)
@@ -1035,6 +1042,13 @@ class Planner {
       static void autotemp_update();
       static void autotemp_M104_M109();
       static void autotemp_task();
+      #if ENABLED(AUTOTEMP_VOLUMETRIC)
+        static celsius_t autotemp_curve[AUTOTEMP_MATERIALS][AUTOTEMP_FLOW_COUNT]; // (°C) Added to the minimum at each flow point
+        static uint8_t autotemp_material;
+        static void autotemp_reset_curves();
+        static float autotemp_flow();
+        static celsius_float_t autotemp_boost(const_float_t flow);
+      #endif
     #endif
 
     #if HAS_LINEAR_E_JERK
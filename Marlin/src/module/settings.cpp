@@ -269,6 +269,10 @@ typedef struct SettingsDataStruct {
   #if ENABLED(AUTOTEMP)
     celsius_t planner_autotemp_max, planner_autotemp_min;
     float planner_autotemp_factor;
+    #if ENABLED(AUTOTEMP_VOLUMETRIC)
+      celsius_t planner_autotemp_curve[AUTOTEMP_MATERIALS][AUTOTEMP_FLOW_COUNT]; // M124 S P C
+      uint8_t planner_autotemp_material;                          // M124 A
+    #endif
   #endif
 
   //
@@ -976,6 +980,10 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(planner.autotemp.max);
       EEPROM_WRITE(planner.autotemp.min);
       EEPROM_WRITE(planner.autotemp.factor);
+      #if ENABLED(AUTOTEMP_VOLUMETRIC)
+        EEPROM_WRITE(planner.autotemp_curve);
+        EEPROM_WRITE(planner.autotemp_material);
+      #endif
     #endif
 
     //
@@ -2042,6 +2050,11 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(planner.autotemp.max);
         EEPROM_READ(planner.autotemp.min);
         EEPROM_READ(planner.autotemp.factor);
+        #if ENABLED(AUTOTEMP_VOLUMETRIC)
+          EEPROM_READ(planner.autotemp_curve);
+          EEPROM_READ(planner.autotemp_material);
+          NOMORE(planner.autotemp_material, AUTOTEMP_MATERIALS - 1);
+        #endif
       #endif
 
       //
@@ -2348,7 +2361,10 @@ void MarlinSettings::postprocess() {
         user_thermistor_t user_thermistor[USER_THERMISTORS];
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(user_thermistor);
-        if (!validating) COPY(thermalManager.user_thermistor, user_thermistor);
+        if (!validating) {
+          COPY(thermalManager.user_thermistor, user_thermistor);
+          for (auto &t : thermalManager.user_thermistor) t.pre_calc = true;
+        }
       }
       #endif
 
@@ -3422,6 +3438,7 @@ void MarlinSettings::reset() {
     planner.autotemp.max = AUTOTEMP_MAX;
     planner.autotemp.min = AUTOTEMP_MIN;
     planner.autotemp.factor = AUTOTEMP_FACTOR;
+    TERN_(AUTOTEMP_VOLUMETRIC, planner.autotemp_reset_curves());
   #endif
 
   //
@@ -4177,6 +4194,11 @@ void MarlinSettings::reset() {
 
     TERN_(HAS_MULTI_LANGUAGE, gcode.M414_report(forReplay));
 
+    //
+    // Volumetric Autotemp curves
+    //
+    TERN_(AUTOTEMP_VOLUMETRIC, gcode.M124_report(forReplay));
+
     //
     // Model predictive control
     //
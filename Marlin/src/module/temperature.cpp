@@ -204,7 +204,7 @@
   #include "probe.h"
 #endif
 
-#if ANY(MPCTEMP, PID_EXTRUSION_SCALING)
+#if ANY(MPCTEMP, PID_EXTRUSION_SCALING, THERMAL_TRACE)
   #include "stepper.h"
 #endif
 
@@ -236,6 +236,10 @@
   #include "servo.h"
 #endif
 
+#if ENABLED(TOUCH_ISR_SAMPLING)
+  #include "../lcd/touch/touch_sampler.h"
+#endif
+
 #if ANY(TEMP_SENSOR_0_IS_THERMISTOR, TEMP_SENSOR_1_IS_THERMISTOR, TEMP_SENSOR_2_IS_THERMISTOR, TEMP_SENSOR_3_IS_THERMISTOR, \
         TEMP_SENSOR_4_IS_THERMISTOR, TEMP_SENSOR_5_IS_THERMISTOR, TEMP_SENSOR_6_IS_THERMISTOR, TEMP_SENSOR_7_IS_THERMISTOR )
   #define HAS_HOTEND_THERMISTOR 1
@@ -246,6 +250,10 @@
   #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
   static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
   static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #if ENABLED(THERMISTOR_DIRECT_INDEX)
+    #define NEXT_TEMPTABLE_INDEX(N) ,TEMPTABLE_##N##_INDEX
+    static const uint8_t* heater_ttidx_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_INDEX REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_INDEX));
+  #endif
 #endif
 
 Temperature thermalManager;
@@ -342,6 +350,9 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
 
   #if ENABLED(MPCTEMP)
     bool MPC::e_paused; // = false
+    #if ENABLED(MPC_FAULT_DETECTION)
+      bool MPC::fault_paused; // = false
+    #endif
     int32_t MPC::e_position; // = 0
   #endif
 
@@ -998,11 +1009,17 @@ volatile bool Temperature::raw_temps_ready = false;
 
   Temperature::MPC_autotuner::MPC_autotuner(const uint8_t extruderIdx) : e(extruderIdx) {
     TERN_(TEMP_TUNING_MAINTAIN_FAN, adaptive_fan_slowing = false);
+    TERN_(MPC_FAULT_DETECTION, MPC::fault_paused = true);
   }
 
   Temperature::MPC_autotuner::~MPC_autotuner() {
     wait_for_heatup = false;
 
+    #if ENABLED(MPC_FAULT_DETECTION)
+      temp_hotend[e].fault_low = temp_hotend[e].fault_high = 0;
+      MPC::fault_paused = false;
+    #endif
+
     ui.reset_status();
 
     temp_hotend[e].target = 0.0f;
@@ -1663,6 +1680,89 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
 
 #endif // HAS_PID_HEATING
 
+#if ENABLED(MPC_FEEDFORWARD)
+
+  /**
+   * Look through the planner queue for the moves due in the next MPC_FEEDFORWARD_TIME
+   * seconds and get the average extrusion speed for the given hotend and the average
+   * fan speed (0-1) for the given fan. Block times are estimated at nominal speed,
+   * which is close enough for planning heater power.
+   */
+  static void mpc_lookahead(const uint8_t ee, const uint8_t fan_index, float &e_speed, float &fan_fraction) {
+    float time = 0.0f, e_mm = 0.0f;
+    #if ENABLED(MPC_INCLUDE_FAN)
+      float fan_time = 0.0f;
+    #else
+      UNUSED(fan_index);
+    #endif
+
+    // Only the planner (not the Stepper ISR) changes the head, so blocks up to it are stable
+    const uint8_t head = planner.block_buffer_head;
+    for (uint8_t b = planner.block_buffer_tail; b != head && time < (MPC_FEEDFORWARD_TIME); b = BLOCK_MOD(b + 1)) {
+      block_t * const block = &planner.block_buffer[b];
+      if (!block->is_move() || block->nominal_speed <= 0.0f) continue;
+
+      const float block_time = block->millimeters / block->nominal_speed,
+                  part = _MIN(1.0f, ((MPC_FEEDFORWARD_TIME) - time) / block_time);   // Part of the block inside the window
+      time += block_time * part;
+
+      if (TERN1(HAS_MULTI_HOTEND, block->extruder == ee) && block->direction_bits.e)
+        e_mm += block->steps.e * planner.mm_per_step[E_AXIS_N(block->extruder)] * part;
+
+      TERN_(MPC_INCLUDE_FAN, fan_time += block->fan_speed[fan_index] * block_time * part);
+    }
+
+    e_speed = time > 0.0f ? e_mm / time : 0.0f;
+    #if ENABLED(MPC_INCLUDE_FAN)
+      fan_fraction = (time > 0.0f ? fan_time / time : thermalManager.fan_speed[fan_index]) * RECIPROCAL(255);
+    #else
+      fan_fraction = 0.0f;
+    #endif
+  }
+
+#endif // MPC_FEEDFORWARD
+
+#if ENABLED(MPC_FAULT_DETECTION)
+
+  /**
+   * Compare the measured temperature with the model's prediction (CUSUM test).
+   * Small errors from noise and model inaccuracy cancel out against the drift.
+   * A sustained error in one direction accumulates until it passes the limit:
+   *  - Colder than modeled: the heater is failing or the thermistor has come loose.
+   *  - Hotter than modeled: the heater is on without being driven.
+   * A part cooling fan that stops shows up as a modeled ambient well above room
+   * temperature while the fan is meant to be on. This is only a warning.
+   */
+  void Temperature::check_mpc_fault(const uint8_t e, const float error, const float fan_fraction) {
+    MPCHeaterInfo &hotend = temp_hotend[e];
+    constexpr float drift = (MPC_FAULT_DRIFT) * MPC_dT;
+    hotend.fault_low = _MAX(0.0f, hotend.fault_low - error - drift);
+    hotend.fault_high = _MAX(0.0f, hotend.fault_high + error - drift);
+
+    if (hotend.fault_low > (MPC_FAULT_LIMIT)) {
+      TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_ERR_HEATING_FAILED)));
+      _TEMP_ERROR(e, F(STR_T_HEATING_FAILED), MSG_ERR_HEATING_FAILED, hotend.celsius);
+    }
+    else if (hotend.fault_high > (MPC_FAULT_LIMIT)) {
+      TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_ERR_THERMAL_RUNAWAY)));
+      _TEMP_ERROR(e, FPSTR(str_t_thermal_runaway), MSG_ERR_THERMAL_RUNAWAY, hotend.celsius);
+    }
+
+    #ifdef MPC_FAULT_FAN_AMBIENT
+      const bool fan_fault = fan_fraction >= 0.5f && hotend.modeled_ambient_temp > (MPC_FAULT_FAN_AMBIENT);
+      if (fan_fault && !hotend.fan_warned) {
+        SERIAL_WARN_MSG("Hotend ", int(e), " cooling less than modeled. Check the part cooling fan.");
+        TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_FAN_SPEED_FAULT)));
+        LCD_ALERTMESSAGE(MSG_FAN_SPEED_FAULT);
+      }
+      hotend.fan_warned = fan_fault;
+    #else
+      UNUSED(fan_fraction);
+    #endif
+  }
+
+#endif // MPC_FAULT_DETECTION
+
 #if HAS_HOTEND
 
   float Temperature::get_pid_output_hotend(const uint8_t E_NAME) {
@@ -1695,6 +1795,10 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
       if (isnan(hotend.modeled_block_temp)) {
         hotend.modeled_ambient_temp = _MIN(30.0f, hotend.celsius);   // Cap initial value at reasonable max room temperature of 30C
         hotend.modeled_block_temp = hotend.modeled_sensor_temp = hotend.celsius;
+        #if ENABLED(MPC_FAULT_DETECTION)
+          hotend.fault_low = hotend.fault_high = 0;
+          hotend.fan_warned = false;
+        #endif
       }
 
       #if HOTENDS == 1
@@ -1708,6 +1812,8 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         const uint8_t fan_index = TERN(SINGLEFAN, 0, ee);
         const float fan_fraction = TERN_(MPC_FAN_0_ACTIVE_HOTEND, !this_hotend ? 0.0f : ) fan_speed[fan_index] * RECIPROCAL(255);
         ambient_xfer_coeff += fan_fraction * mpc.fan255_adjustment;
+      #elif ENABLED(MPC_FAULT_DETECTION)
+        constexpr float fan_fraction = 0.0f;
       #endif
 
       if (this_hotend) {
@@ -1723,8 +1829,8 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         }
       }
 
-      // Update the modeled temperatures
-      float blocktempdelta = hotend.soft_pwm_amount * mpc.heater_power * (MPC_dT / 127) / mpc.block_heat_capacity;
+      // Update the modeled temperatures with the power actually delivered
+      float blocktempdelta = TERN(HEATER_POWER_BUDGET, hotend.soft_pwm_granted, hotend.soft_pwm_amount) * mpc.heater_power * (MPC_dT / 127) / mpc.block_heat_capacity;
       blocktempdelta += (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff * MPC_dT / mpc.block_heat_capacity;
       hotend.modeled_block_temp += blocktempdelta;
 
@@ -1733,6 +1839,10 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
 
       // Any delta between hotend.modeled_sensor_temp and hotend.celsius is either model
       // error diverging slowly or (fast) noise. Slowly correct towards this temperature and noise will average out.
+      #if ENABLED(MPC_FAULT_DETECTION)
+        if (!MPC::fault_paused && !MPC::e_paused) check_mpc_fault(ee, hotend.celsius - hotend.modeled_sensor_temp, fan_fraction);
+      #endif
+
       const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
       hotend.modeled_block_temp += delta_to_apply;
       hotend.modeled_sensor_temp += delta_to_apply;
@@ -1743,6 +1853,15 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
 
       float power = 0.0;
       if (hotend.target != 0 && !is_idling) {
+        #if ENABLED(MPC_FEEDFORWARD)
+          // Plan for the extrusion and fan speeds coming up, not the current ones
+          float e_speed_ahead, fan_ahead;
+          mpc_lookahead(ee, TERN(SINGLEFAN, 0, ee), e_speed_ahead, fan_ahead);
+          ambient_xfer_coeff = mpc.ambient_xfer_coeff_fan0;
+          TERN_(MPC_INCLUDE_FAN, ambient_xfer_coeff += TERN_(MPC_FAN_0_ACTIVE_HOTEND, !this_hotend ? 0.0f : ) fan_ahead * mpc.fan255_adjustment);
+          if (!MPC::e_paused) ambient_xfer_coeff += e_speed_ahead * mpc.filament_heat_capacity_permm;
+        #endif
+
         // Plan power level to get to target temperature in 2 seconds
         power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity / 2.0f;
         power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff;
@@ -2202,6 +2321,8 @@ void Temperature::task() {
     #endif
   #endif
 
+  TERN_(MAX_TC_SCHEDULER, max_tc_service());
+
   if (!updateTemperaturesIfReady()) return; // Will also reset the watchdog if temperatures are ready
 
   #if DISABLED(IGNORE_THERMOCOUPLE_ERRORS)
@@ -2244,6 +2365,9 @@ void Temperature::task() {
 
   const millis_t ms = millis();
 
+  // Rank heaters by the new temperatures for the power budget
+  TERN_(HEATER_POWER_BUDGET, update_power_order(ms));
+
   // Handle Hotend Temp Errors, Heating Watch, etc.
   TERN_(HAS_HOTEND, manage_hotends(ms));
 
@@ -2285,6 +2409,8 @@ void Temperature::task() {
     #endif
   #endif
 
+  TERN_(THERMAL_TRACE, report_thermal_trace(ms));
+
   UNUSED(ms);
 }
 
@@ -2293,6 +2419,37 @@ void Temperature::task() {
 // For a 5V input the AD8495 returns a value scaled with 5mV per °C. (Minimum input voltage is 2.7V.)
 #define TEMP_AD8495(RAW) ((RAW) * (ADC_VREF_MV /  5) / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD8495_GAIN) + TEMP_SENSOR_AD8495_OFFSET)
 
+#if ENABLED(THERMISTOR_DIRECT_INDEX)
+
+  /**
+   * Use the direct index to find the table segment holding the 'raw' value,
+   * then interpolate between the under and over values in 1/16 °C fixed-point.
+   * User thermistor tables are in RAM with 1/16 °C values.
+   */
+  template<bool USER>
+  static celsius_float_t thermistor_lookup(const temp_entry_t * const tbl, const uint8_t len, const uint8_t * const index, const uint8_t shift, raw_adc_t raw) {
+    #define TT_VALUE(I) raw_adc_t(USER ? tbl[I].value : pgm_read_word(&tbl[I].value))
+    #define TT_CELSIUS(I) (int32_t(celsius_t(USER ? tbl[I].celsius : pgm_read_word(&tbl[I].celsius))) << (USER ? 0 : 4))
+    NOMORE(raw, MAX_RAW_THERMISTOR_VALUE);
+    uint8_t s = USER ? index[raw >> shift] : pgm_read_byte(&index[raw >> shift]);
+    raw_adc_t v0 = TT_VALUE(s);
+    if (raw <= v0) return TT_CELSIUS(s) * 0.0625f;  // Below the first entry
+    for (;;) {
+      if (s + 1 >= len) return TT_CELSIUS(s) * 0.0625f; // Above the last entry
+      const raw_adc_t v1 = TT_VALUE(s + 1);
+      if (raw <= v1) {
+        const int32_t c0 = TT_CELSIUS(s);
+        return (c0 + int32_t(raw - v0) * (TT_CELSIUS(s + 1) - c0) / int32_t(v1 - v0)) * 0.0625f;
+      }
+      v0 = v1;
+      s++;
+    }
+  }
+
+  #define SCAN_THERMISTOR_TABLE(TBL,LEN) return thermistor_lookup<false>(TBL, LEN, TT_INDEX(TBL), THERMISTOR_INDEX_SHIFT, raw)
+
+#else
+
 /**
  * Bisect search for the range of the 'raw' value, then interpolate
  * proportionally between the under and over values.
@@ -2315,6 +2472,8 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+#endif // !THERMISTOR_DIRECT_INDEX
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -2399,20 +2558,28 @@ void Temperature::task() {
     );
   }
 
-  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
+  #if ENABLED(THERMISTOR_DIRECT_INDEX)
 
-    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
+    /**
+     * User thermistor tables, rebuilt after M305 changes a thermistor.
+     * Entries are spaced 5°C apart and hold 1/16 °C values,
+     * with a direct index like the built-in tables. Readings
+     * outside the table range are calculated directly.
+     */
+    #define USER_TT_MINTEMP  -20
+    #define USER_TT_MAXTEMP  420
+    #define USER_TT_STEP       5
+    #define USER_TT_LEN      ((USER_TT_MAXTEMP - (USER_TT_MINTEMP)) / (USER_TT_STEP) + 1)
+    #define USER_TT_INDEX_BITS 6
+    #define USER_TT_INDEX_SHIFT (THERMISTOR_RAW_BITS - (USER_TT_INDEX_BITS))
+    static temp_entry_t user_ttbl[USER_THERMISTORS][USER_TT_LEN];
+    static uint8_t user_ttbl_len[USER_THERMISTORS],
+                   user_ttbl_index[USER_THERMISTORS][_BV(USER_TT_INDEX_BITS)];
 
-    user_thermistor_t &t = user_thermistor[t_index];
-    if (t.pre_calc) { // pre-calculate some variables
-      t.pre_calc     = false;
-      t.res_25_recip = 1.0f / t.res_25;
-      t.res_25_log   = logf(t.res_25);
-      t.beta_recip   = 1.0f / t.beta;
-      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
-                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
-    }
+  #endif
 
+  // Convert a raw value with the Steinhart-Hart equation
+  static float user_thermistor_calc(const user_thermistor_t &t, const raw_adc_t raw) {
     // Maximum ADC value .. take into account the over sampling
     constexpr raw_adc_t adc_max = MAX_RAW_THERMISTOR_VALUE;
     const raw_adc_t adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
@@ -2430,6 +2597,52 @@ void Temperature::task() {
     // Return degrees C (up to 999, as the LCD only displays 3 digits)
     return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
   }
+
+  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
+
+    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
+
+    user_thermistor_t &t = user_thermistor[t_index];
+    if (t.pre_calc) { // pre-calculate some variables
+      t.pre_calc     = false;
+      t.res_25_recip = 1.0f / t.res_25;
+      t.res_25_log   = logf(t.res_25);
+      t.beta_recip   = 1.0f / t.beta;
+      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
+                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+
+      #if ENABLED(THERMISTOR_DIRECT_INDEX)
+        // Place entries by the beta equation, hottest first for ascending raw values,
+        // then get each entry's temperature with the full equation.
+        temp_entry_t * const tbl = user_ttbl[t_index];
+        constexpr float adc_max = MAX_RAW_THERMISTOR_VALUE;
+        uint8_t len = 0;
+        for (int16_t c = USER_TT_MAXTEMP; c >= USER_TT_MINTEMP; c -= USER_TT_STEP) {
+          const float res = t.res_25 * expf(t.beta * (RECIPROCAL(c - (THERMISTOR_ABS_ZERO_C)) - RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C)))),
+                      raw_f = adc_max * res / (res + t.series_res);
+          const raw_adc_t r = raw_adc_t(constrain(raw_f, 1, adc_max - 1));
+          if (len && r <= tbl[len - 1].value) continue;
+          tbl[len++] = { r, celsius_t(LROUND(user_thermistor_calc(t, r) * 16)) };
+        }
+        user_ttbl_len[t_index] = len;
+        for (uint8_t i = 0, s = 0; i < COUNT(user_ttbl_index[0]); ++i) {
+          const raw_adc_t r = raw_adc_t(i) << USER_TT_INDEX_SHIFT;
+          while (s + 1 < len && tbl[s + 1].value <= r) s++;
+          user_ttbl_index[t_index][i] = s;
+        }
+      #endif
+    }
+
+    #if ENABLED(THERMISTOR_DIRECT_INDEX)
+      // Outside the table use the equation, so a MAXTEMP above USER_TT_MAXTEMP can still trip
+      const temp_entry_t * const tbl = user_ttbl[t_index];
+      const uint8_t len = user_ttbl_len[t_index];
+      if (raw > tbl[0].value && raw < tbl[len - 1].value)
+        return thermistor_lookup<true>(tbl, len, user_ttbl_index[t_index], USER_TT_INDEX_SHIFT, raw);
+    #endif
+
+    return user_thermistor_calc(t, raw);
+  }
 #endif
 
 #if HAS_HOTEND
@@ -2557,8 +2770,12 @@ void Temperature::task() {
 
     #if HAS_HOTEND_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #if ENABLED(THERMISTOR_DIRECT_INDEX)
+        return thermistor_lookup<false>(heater_ttbl_map[e], heater_ttbllen_map[e], heater_ttidx_map[e], THERMISTOR_INDEX_SHIFT, raw);
+      #else
+        const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+        SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #endif
     #endif
 
     return 0;
@@ -2718,20 +2935,28 @@ void Temperature::updateTemperaturesFromRawValues() {
 
   hal.watchdog_refresh(); // Reset because raw_temps_ready was set by the interrupt
 
+  #if ENABLED(MAX_TC_SCHEDULER)
+    // Latest readings from max_tc_service()
+    #define _MAX_TC_RAW(N) max_tc_raw[N]
+    #define _MAX_TC_RAW_BED() max_tc_raw[MAX_TC_SLOT_BED]
+  #else
+    #define _MAX_TC_RAW(N) READ_MAX_TC(N)
+    #define _MAX_TC_RAW_BED() read_max_tc_bed()
+  #endif
   #if TEMP_SENSOR_IS_MAX_TC(0)
-    temp_hotend[0].setraw(READ_MAX_TC(0));
+    temp_hotend[0].setraw(_MAX_TC_RAW(0));
   #endif
   #if TEMP_SENSOR_IS_MAX_TC(1)
-    temp_hotend[1].setraw(READ_MAX_TC(1));
+    temp_hotend[1].setraw(_MAX_TC_RAW(1));
   #endif
   #if TEMP_SENSOR_IS_MAX_TC(2)
-    temp_hotend[2].setraw(READ_MAX_TC(2));
+    temp_hotend[2].setraw(_MAX_TC_RAW(2));
   #endif
   #if TEMP_SENSOR_IS_MAX_TC(REDUNDANT)
-    temp_redundant.setraw(READ_MAX_TC(HEATER_ID(TEMP_SENSOR_REDUNDANT_SOURCE)));
+    temp_redundant.setraw(_MAX_TC_RAW(HEATER_ID(TEMP_SENSOR_REDUNDANT_SOURCE)));
   #endif
   #if TEMP_SENSOR_IS_MAX_TC(BED)
-    temp_bed.setraw(read_max_tc_bed());
+    temp_bed.setraw(_MAX_TC_RAW_BED());
   #endif
 
   #if HAS_HOTEND
@@ -2812,6 +3037,92 @@ void Temperature::updateTemperaturesFromRawValues() {
 
 } // Temperature::updateTemperaturesFromRawValues
 
+#if ENABLED(ADC_SCAN_SAMPLING)
+
+  /**
+   * Every analog input is handed to the HAL scan engine, thermal sensors first.
+   * The others are still read one at a time by the ISR, but they must be in the
+   * scan so the HAL can serve them without interrupting it.
+   */
+  enum ADCScanIndex : uint8_t {
+    OPTITEM(HAS_TEMP_ADC_0,         ADCScan_TEMP_0)
+    OPTITEM(HAS_TEMP_ADC_1,         ADCScan_TEMP_1)
+    OPTITEM(HAS_TEMP_ADC_2,         ADCScan_TEMP_2)
+    OPTITEM(HAS_TEMP_ADC_3,         ADCScan_TEMP_3)
+    OPTITEM(HAS_TEMP_ADC_4,         ADCScan_TEMP_4)
+    OPTITEM(HAS_TEMP_ADC_5,         ADCScan_TEMP_5)
+    OPTITEM(HAS_TEMP_ADC_6,         ADCScan_TEMP_6)
+    OPTITEM(HAS_TEMP_ADC_7,         ADCScan_TEMP_7)
+    OPTITEM(HAS_TEMP_ADC_BED,       ADCScan_TEMP_BED)
+    OPTITEM(HAS_TEMP_ADC_CHAMBER,   ADCScan_TEMP_CHAMBER)
+    OPTITEM(HAS_TEMP_ADC_PROBE,     ADCScan_TEMP_PROBE)
+    OPTITEM(HAS_TEMP_ADC_COOLER,    ADCScan_TEMP_COOLER)
+    OPTITEM(HAS_TEMP_ADC_BOARD,     ADCScan_TEMP_BOARD)
+    OPTITEM(HAS_TEMP_ADC_SOC,       ADCScan_TEMP_SOC)
+    OPTITEM(HAS_TEMP_ADC_REDUNDANT, ADCScan_TEMP_REDUNDANT)
+    OPTITEM(HAS_JOY_ADC_X,          ADCScan_JOY_X)
+    OPTITEM(HAS_JOY_ADC_Y,          ADCScan_JOY_Y)
+    OPTITEM(HAS_JOY_ADC_Z,          ADCScan_JOY_Z)
+    OPTITEM(FILAMENT_WIDTH_SENSOR,  ADCScan_FILWIDTH)
+    OPTITEM(HAS_ADC_BUTTONS,        ADCScan_ADC_KEY)
+    OPTITEM(POWER_MONITOR_CURRENT,  ADCScan_POWERMON_CURRENT)
+    OPTITEM(POWER_MONITOR_VOLTAGE,  ADCScan_POWERMON_VOLTAGE)
+    ADC_SCAN_COUNT
+  };
+
+  static_assert(ADC_SCAN_COUNT <= HAL_ADC_SCAN_MAX, "ADC_SCAN_SAMPLING supports up to " STRINGIFY(HAL_ADC_SCAN_MAX) " analog inputs on this MCU.");
+
+  static const pin_t adc_scan_pins[] = {
+    OPTITEM(HAS_TEMP_ADC_0,         TEMP_0_PIN)
+    OPTITEM(HAS_TEMP_ADC_1,         TEMP_1_PIN)
+    OPTITEM(HAS_TEMP_ADC_2,         TEMP_2_PIN)
+    OPTITEM(HAS_TEMP_ADC_3,         TEMP_3_PIN)
+    OPTITEM(HAS_TEMP_ADC_4,         TEMP_4_PIN)
+    OPTITEM(HAS_TEMP_ADC_5,         TEMP_5_PIN)
+    OPTITEM(HAS_TEMP_ADC_6,         TEMP_6_PIN)
+    OPTITEM(HAS_TEMP_ADC_7,         TEMP_7_PIN)
+    OPTITEM(HAS_TEMP_ADC_BED,       TEMP_BED_PIN)
+    OPTITEM(HAS_TEMP_ADC_CHAMBER,   TEMP_CHAMBER_PIN)
+    OPTITEM(HAS_TEMP_ADC_PROBE,     TEMP_PROBE_PIN)
+    OPTITEM(HAS_TEMP_ADC_COOLER,    TEMP_COOLER_PIN)
+    OPTITEM(HAS_TEMP_ADC_BOARD,     TEMP_BOARD_PIN)
+    OPTITEM(HAS_TEMP_ADC_SOC,       TEMP_SOC_PIN)
+    OPTITEM(HAS_TEMP_ADC_REDUNDANT, TEMP_REDUNDANT_PIN)
+    OPTITEM(HAS_JOY_ADC_X,          JOY_X_PIN)
+    OPTITEM(HAS_JOY_ADC_Y,          JOY_Y_PIN)
+    OPTITEM(HAS_JOY_ADC_Z,          JOY_Z_PIN)
+    OPTITEM(FILAMENT_WIDTH_SENSOR,  FILWIDTH_PIN)
+    OPTITEM(HAS_ADC_BUTTONS,        ADC_KEYPAD_PIN)
+    OPTITEM(POWER_MONITOR_CURRENT,  POWER_MONITOR_CURRENT_PIN)
+    OPTITEM(POWER_MONITOR_VOLTAGE,  POWER_MONITOR_VOLTAGE_PIN)
+  };
+
+  /**
+   * Accumulate the latest conversion of every thermal sensor at once.
+   * Called by the ISR at the start of each sampling loop.
+   */
+  void Temperature::sample_adc_scan() {
+    #define SCAN_SAMPLE(obj, N) obj.sample(hal.adc_scan_value(ADCScan_TEMP_##N))
+    TERN_(HAS_TEMP_ADC_0,         SCAN_SAMPLE(temp_hotend[0], 0));
+    TERN_(HAS_TEMP_ADC_1,         SCAN_SAMPLE(temp_hotend[1], 1));
+    TERN_(HAS_TEMP_ADC_2,         SCAN_SAMPLE(temp_hotend[2], 2));
+    TERN_(HAS_TEMP_ADC_3,         SCAN_SAMPLE(temp_hotend[3], 3));
+    TERN_(HAS_TEMP_ADC_4,         SCAN_SAMPLE(temp_hotend[4], 4));
+    TERN_(HAS_TEMP_ADC_5,         SCAN_SAMPLE(temp_hotend[5], 5));
+    TERN_(HAS_TEMP_ADC_6,         SCAN_SAMPLE(temp_hotend[6], 6));
+    TERN_(HAS_TEMP_ADC_7,         SCAN_SAMPLE(temp_hotend[7], 7));
+    TERN_(HAS_TEMP_ADC_BED,       SCAN_SAMPLE(temp_bed, BED));
+    TERN_(HAS_TEMP_ADC_CHAMBER,   SCAN_SAMPLE(temp_chamber, CHAMBER));
+    TERN_(HAS_TEMP_ADC_PROBE,     SCAN_SAMPLE(temp_probe, PROBE));
+    TERN_(HAS_TEMP_ADC_COOLER,    SCAN_SAMPLE(temp_cooler, COOLER));
+    TERN_(HAS_TEMP_ADC_BOARD,     SCAN_SAMPLE(temp_board, BOARD));
+    TERN_(HAS_TEMP_ADC_SOC,       SCAN_SAMPLE(temp_soc, SOC));
+    TERN_(HAS_TEMP_ADC_REDUNDANT, SCAN_SAMPLE(temp_redundant, REDUNDANT));
+    #undef SCAN_SAMPLE
+  }
+
+#endif // ADC_SCAN_SAMPLING
+
 /**
  * Initialize the temperature manager
  *
@@ -2989,6 +3300,8 @@ void Temperature::init() {
     OUT_WRITE(COOLER_PIN, ENABLED(COOLER_INVERTING));
   #endif
 
+  TERN_(HARDWARE_PWM_HEATERS, init_hardware_pwm());
+
   #if HAS_FAN0
     INIT_FAN_PIN(FAN0_PIN);
   #endif
@@ -3043,6 +3356,7 @@ void Temperature::init() {
   TERN_(HAS_ADC_BUTTONS,        hal.adc_enable(ADC_KEYPAD_PIN));
   TERN_(POWER_MONITOR_CURRENT,  hal.adc_enable(POWER_MONITOR_CURRENT_PIN));
   TERN_(POWER_MONITOR_VOLTAGE,  hal.adc_enable(POWER_MONITOR_VOLTAGE_PIN));
+  TERN_(ADC_SCAN_SAMPLING,      hal.adc_scan_init(adc_scan_pins, ADC_SCAN_COUNT));
 
   #if HAS_JOY_ADC_EN
     SET_INPUT_PULLUP(JOY_EN_PIN);
@@ -3372,6 +3686,7 @@ void Temperature::disable_all_heaters() {
 
   // Disable autotemp, unpause and reset everything
   TERN_(AUTOTEMP, planner.autotemp.enabled = false);
+  TERN_(HEATUP_AND_CONTINUE, deferred_heatup = 0);
   TERN_(PROBING_HEATERS_OFF, pause_heaters(false));
 
   #if HAS_HOTEND
@@ -3392,6 +3707,10 @@ void Temperature::disable_all_heaters() {
     WRITE_HEATER_BED(LOW);
   #endif
 
+  #if ENABLED(HARDWARE_PWM_HEATERS)
+    for (uint8_t h = 0; h < COUNT(hardware_pwm_duty); ++h) hardware_pwm(h, 0);
+  #endif
+
   #if HAS_HEATED_CHAMBER
     setTargetChamber(0);
     temp_chamber.soft_pwm_amount = 0;
@@ -3534,14 +3853,17 @@ void Temperature::disable_all_heaters() {
     );
 
     static uint8_t max_tc_errors[MAX_TC_COUNT] = { 0 };
-    static millis_t next_max_tc_ms[MAX_TC_COUNT] = { 0 };
 
-    // Return last-read value between readings
-    const millis_t ms = millis();
-    if (PENDING(ms, next_max_tc_ms[hindex]))
-      return THERMO_TEMP(hindex);
+    #if DISABLED(MAX_TC_SCHEDULER) // Scheduler calls only when a reading is due
+      static millis_t next_max_tc_ms[MAX_TC_COUNT] = { 0 };
 
-    next_max_tc_ms[hindex] = ms + MAXTC_HEAT_INTERVAL;
+      // Return last-read value between readings
+      const millis_t ms = millis();
+      if (PENDING(ms, next_max_tc_ms[hindex]))
+        return THERMO_TEMP(hindex);
+
+      next_max_tc_ms[hindex] = ms + MAXTC_HEAT_INTERVAL;
+    #endif
 
     #if !HAS_MAXTC_LIBRARIES
       max_tc_temp = 0;
@@ -3659,12 +3981,15 @@ void Temperature::disable_all_heaters() {
     static max_tc_temp_t max_tc_temp = TEMP_SENSOR_BED_MAX_TC_TMAX;
 
     static uint8_t max_tc_errors = 0;
-    static millis_t next_max_tc_ms = 0;
 
-    // Return last-read value between readings
-    const millis_t ms = millis();
-    if (PENDING(ms, next_max_tc_ms)) return max_tc_temp;
-    next_max_tc_ms = ms + MAXTC_HEAT_INTERVAL;
+    #if DISABLED(MAX_TC_SCHEDULER) // Scheduler calls only when a reading is due
+      static millis_t next_max_tc_ms = 0;
+
+      // Return last-read value between readings
+      const millis_t ms = millis();
+      if (PENDING(ms, next_max_tc_ms)) return max_tc_temp;
+      next_max_tc_ms = ms + MAXTC_HEAT_INTERVAL;
+    #endif
 
     #if !HAS_MAXTC_LIBRARIES
       max_tc_temp = 0;
@@ -3748,6 +4073,113 @@ void Temperature::disable_all_heaters() {
 
 #endif // TEMP_SENSOR_IS_MAX_TC(BED)
 
+#if ENABLED(MAX_TC_SCHEDULER)
+
+  /**
+   * Shared-bus scheduler for MAX thermocouple and RTD boards.
+   *
+   * Called from task() on every idle pass. It does at most one board read per pass,
+   * choosing the board whose new reading has been ready longest, so other SPI users
+   * (SD card, TMC drivers) wait for no more than one short transaction. A board is
+   * read as soon as its next conversion is ready, but no faster than temperatures
+   * are updated. The MAX31865 driver paces its own one-shot cycle.
+   */
+
+  // Temperatures are updated this often (ms)
+  #define MAX_TC_UPDATE_MS uint16_t(1000UL * (OVERSAMPLENR) * (ACTUAL_ADC_SAMPLES) / (TEMP_TIMER_FREQUENCY))
+
+  // Read interval (ms) for the board in slot N: MAX6675 converts in 220ms, MAX31855 in 100ms, MAX31865 (auto) in 21ms.
+  // A one-shot MAX31865 is called every 2ms (its bias settling time) to step its cycle. Calls between steps don't touch the bus.
+  #define MAX_TC_READ_MS(N) ( \
+      ENABLED(TEMP_SENSOR_##N##_IS_MAX6675)  ? _MAX(220, MAX_TC_UPDATE_MS) \
+    : ENABLED(TEMP_SENSOR_##N##_IS_MAX31855) ? _MAX(100, MAX_TC_UPDATE_MS) \
+    : ENABLED(TEMP_SENSOR_##N##_IS_MAX31865) ? TERN(MAX31865_USE_AUTO_MODE, _MAX(21, MAX_TC_UPDATE_MS), 2) \
+    : 0 \
+  )
+
+  raw_adc_t Temperature::max_tc_raw[MAX_TC_SLOTS]; // = { 0 }
+
+  static struct {
+    millis_t due_ms;          // When the next reading is ready
+    uint16_t last_us, max_us; // Time spent on the bus
+  } max_tc_slot[Temperature::MAX_TC_SLOTS];
+
+  static uint32_t max_tc_busy_us;     // Bus time since the last report
+  static millis_t max_tc_window_ms;   // Start of the report window
+
+  // Boards present and their read intervals
+  constexpr bool max_tc_present[] = {
+    TEMP_SENSOR_IS_ANY_MAX_TC(0), TEMP_SENSOR_IS_ANY_MAX_TC(1), TEMP_SENSOR_IS_ANY_MAX_TC(2), TEMP_SENSOR_IS_MAX_TC(BED)
+  };
+  constexpr uint16_t max_tc_read_ms[] = { MAX_TC_READ_MS(0), MAX_TC_READ_MS(1), MAX_TC_READ_MS(2), MAX_TC_READ_MS(BED) };
+
+  void Temperature::max_tc_service() {
+    const millis_t ms = millis();
+    if (!max_tc_window_ms) max_tc_window_ms = ms;
+
+    // Read every board the first time so all temperatures start out valid
+    const bool first = !max_tc_slot[MAX_TC_SLOT_BED].due_ms && !max_tc_slot[MAX_TC_SLOT_0].due_ms && !max_tc_slot[MAX_TC_SLOT_1].due_ms && !max_tc_slot[MAX_TC_SLOT_2].due_ms;
+
+    for (;;) {
+      // Pick the board that has been ready the longest
+      uint8_t slot = MAX_TC_SLOTS;
+      millis_t oldest = 0;
+      for (uint8_t s = 0; s < MAX_TC_SLOTS; ++s) {
+        if (!max_tc_present[s] || (first && max_tc_slot[s].due_ms)) continue;
+        const millis_t late = ms - max_tc_slot[s].due_ms;
+        if (ELAPSED(ms, max_tc_slot[s].due_ms) && (slot == MAX_TC_SLOTS || late > oldest)) { slot = s; oldest = late; }
+      }
+      if (slot == MAX_TC_SLOTS) return;
+
+      const uint32_t start_us = micros();
+      raw_adc_t raw = 0;
+      switch (slot) {
+        #if TEMP_SENSOR_IS_ANY_MAX_TC(0)
+          case MAX_TC_SLOT_0: raw = READ_MAX_TC(0); break;
+        #endif
+        #if TEMP_SENSOR_IS_ANY_MAX_TC(1)
+          case MAX_TC_SLOT_1: raw = READ_MAX_TC(1); break;
+        #endif
+        #if TEMP_SENSOR_IS_ANY_MAX_TC(2)
+          case MAX_TC_SLOT_2: raw = READ_MAX_TC(2); break;
+        #endif
+        #if TEMP_SENSOR_IS_MAX_TC(BED)
+          case MAX_TC_SLOT_BED: raw = read_max_tc_bed(); break;
+        #endif
+        default: break;
+      }
+      const uint16_t us = _MIN(micros() - start_us, 0xFFFFUL);
+
+      max_tc_raw[slot] = raw;
+      max_tc_slot[slot].due_ms = (ms + max_tc_read_ms[slot]) | 1; // Never 0 once read
+      max_tc_slot[slot].last_us = us;
+      NOLESS(max_tc_slot[slot].max_us, us);
+      max_tc_busy_us += us;
+
+      if (!first) return;
+    }
+  }
+
+  /**
+   * Report the time each board read took on the bus, the worst case, how often
+   * each board is read, and the share of time the bus was busy with them since
+   * the last report.
+   */
+  void Temperature::report_max_tc_bus() {
+    static const char slot_name[][4] PROGMEM = { "E0", "E1", "E2", "BED" };
+    for (uint8_t s = 0; s < MAX_TC_SLOTS; ++s) {
+      if (!max_tc_present[s]) continue;
+      SERIAL_ECHOLN(FPSTR(slot_name[s]), F(" read "), max_tc_slot[s].last_us, F("us max "), max_tc_slot[s].max_us, F("us every "), max_tc_read_ms[s], F("ms"));
+      max_tc_slot[s].max_us = 0;
+    }
+    const millis_t ms = millis(), span_ms = ms - max_tc_window_ms;
+    SERIAL_ECHOLN(F("SPI bus "), p_float_t(span_ms ? max_tc_busy_us * 0.1f / span_ms : 0.0f, 2), F("% busy"));
+    max_tc_busy_us = 0;
+    max_tc_window_ms = ms;
+  }
+
+#endif // MAX_TC_SCHEDULER
+
 /**
  * Update raw temperatures
  *
@@ -3853,12 +4285,79 @@ HAL_TEMP_TIMER_ISR() {
   #define MIN_STATE_TIME 16 // MIN_STATE_TIME * 65.5 = time in milliseconds
 #endif
 
+#if ENABLED(SOFT_PWM_SIGMA_DELTA)
+  /**
+   * First-order sigma-delta modulator. Called on every ISR tick the output
+   * is on for 'amount' out of every 'full' ticks, spread as evenly as possible.
+   */
+  inline bool sigma_delta(uint8_t &acc, const uint8_t amount, const uint8_t full) {
+    const uint8_t rest = full - _MIN(amount, full);
+    if (acc >= rest) { acc -= rest; return true; }
+    acc += amount;
+    return false;
+  }
+#endif
+
+#if ENABLED(HARDWARE_PWM_HEATERS)
+
+  uint16_t Temperature::hardware_pwm_mask; // = 0
+  uint8_t Temperature::hardware_pwm_duty[HOTENDS + ENABLED(HAS_HEATED_BED)]; // = { 0 }
+
+  // Hand heaters on timer-capable pins over to hardware PWM
+  void Temperature::init_hardware_pwm() {
+    #define _INIT_HW_PWM(N,H) do{                                                             \
+      if (PWM_PIN(HEATER_##N##_PIN)) {                                                        \
+        SET_PWM(HEATER_##N##_PIN);                                                            \
+        hal.set_pwm_frequency(pin_t(HEATER_##N##_PIN), HARDWARE_PWM_HEATERS_FREQUENCY);       \
+        hal.set_pwm_duty(pin_t(HEATER_##N##_PIN), 0, 255, ENABLED(HEATER_##N##_INVERTING));   \
+        SBI(hardware_pwm_mask, H);                                                            \
+      }                                                                                       \
+    }while(0)
+    #define _INIT_HW_PWM_E(N) _INIT_HW_PWM(N,N);
+    REPEAT(HOTENDS, _INIT_HW_PWM_E);
+    TERN_(HAS_HEATED_BED, _INIT_HW_PWM(BED, HOTENDS));
+  }
+
+  // Set the hardware duty of a heater (0-127) when it changes. Return false for soft PWM heaters.
+  bool Temperature::hardware_pwm(const uint8_t h, const uint8_t amount) {
+    if (!TEST(hardware_pwm_mask, h)) return false;
+    if (amount != hardware_pwm_duty[h]) {
+      hardware_pwm_duty[h] = amount;
+      const uint8_t duty = amount >= 127 ? 255 : amount << 1;
+      switch (h) {
+        #define _HW_PWM_DUTY(N) case N: hal.set_pwm_duty(pin_t(HEATER_##N##_PIN), duty, 255, ENABLED(HEATER_##N##_INVERTING)); break;
+        REPEAT(HOTENDS, _HW_PWM_DUTY)
+        #if HAS_HEATED_BED
+          default: hal.set_pwm_duty(pin_t(HEATER_BED_PIN), duty, 255, ENABLED(HEATER_BED_INVERTING)); break;
+        #endif
+      }
+    }
+    return true;
+  }
+
+  // Skip the software PWM of heaters on hardware PWM pins
+  #define SOFT_PWM_HEATER(H,T) if (!hardware_pwm(H, T.soft_pwm_amount))
+  #define SOFT_PWM_PIN(H)      if (!TEST(hardware_pwm_mask, H))
+
+#else
+
+  #define SOFT_PWM_HEATER(H,T)
+  #define SOFT_PWM_PIN(H)
+
+#endif
+
 class SoftPWM {
 public:
   uint8_t count;
   inline bool add(const uint8_t mask, const uint8_t amount) {
     count = (count & mask) + amount; return (count > mask);
   }
+  #if ENABLED(HEATER_POWER_BUDGET)
+    // On for 'count' ticks starting at 'phase', wrapping around the PWM period
+    inline bool on(const uint8_t pwm, const uint8_t phase) const {
+      return uint8_t(pwm >= phase ? pwm - phase : pwm + 127 - phase) < count;
+    }
+  #endif
   #if ENABLED(SLOW_PWM_HEATERS)
     bool state_heater;
     uint8_t state_timer_heater;
@@ -3874,6 +4373,109 @@ public:
   #endif
 };
 
+#if ENABLED(HEATER_POWER_BUDGET)
+
+  Temperature::power_order_t Temperature::power_order[2];
+  volatile uint8_t Temperature::power_order_sel; // = 0
+
+  heater_info_t& Temperature::power_heater(const uint8_t i) {
+    OPTCODE(HAS_HEATED_BED, if (i == POWER_INDEX_BED) return temp_bed)
+    OPTCODE(HAS_HEATED_CHAMBER, if (i == POWER_INDEX_CHAMBER) return temp_chamber)
+    return temp_hotend[i];
+  }
+
+  uint16_t Temperature::power_watts(const uint8_t i) {
+    OPTCODE(HAS_HEATED_BED, if (i == POWER_INDEX_BED) return BED_HEATER_POWER)
+    OPTCODE(HAS_HEATED_CHAMBER, if (i == POWER_INDEX_CHAMBER) return CHAMBER_HEATER_POWER)
+    static constexpr uint16_t hotend_watts[] = HOTEND_HEATER_POWER;
+    return hotend_watts[i];
+  }
+
+  // Push a heating watch out by the part of the last interval the budget withheld
+  template<typename W>
+  static void power_delay_watch(W &watch, const heater_info_t &h, const millis_t dt) {
+    const uint8_t want = _MIN(h.soft_pwm_amount, 127U), got = h.soft_pwm_granted;
+    if (watch.next_ms && got < want) watch.next_ms += dt * (want - got) / want;
+  }
+
+  /**
+   * Sort the heaters by distance from their target, putting heaters that are
+   * holding temperature first. These must be kept at temperature while the
+   * others can heat up a little more slowly. Called with each new set of
+   * temperatures. The order is built in the spare buffer and handed to the
+   * ISR with a single byte write.
+   *
+   * Heaters held back by the budget get more time to pass their heating watch.
+   */
+  void Temperature::update_power_order(const millis_t &ms) {
+    power_order_t &po = power_order[!power_order_sel];
+    celsius_float_t gap[NR_POWER_HEATERS];
+    po.hold_count = 0;
+    for (uint8_t i = 0; i < NR_POWER_HEATERS; ++i) {
+      const heater_info_t &h = power_heater(i);
+      celsius_float_t g = ABS(h.target - h.celsius);
+      const celsius_t window = TERN_(HAS_HEATED_BED, i == POWER_INDEX_BED ? TEMP_BED_HYSTERESIS :)
+                               TERN_(HAS_HEATED_CHAMBER, i == POWER_INDEX_CHAMBER ? TEMP_CHAMBER_HYSTERESIS :)
+                               TEMP_HYSTERESIS;
+      if (g <= window) po.hold_count++; else g += 1000;
+      uint8_t j = i;
+      for (; j && gap[j - 1] > g; --j) { gap[j] = gap[j - 1]; po.heater[j] = po.heater[j - 1]; }
+      gap[j] = g; po.heater[j] = i;
+    }
+    power_order_sel = !power_order_sel;
+
+    static millis_t prev_ms; // = 0
+    const millis_t dt = prev_ms ? ms - prev_ms : 0;
+    prev_ms = ms;
+    #if WATCH_HOTENDS
+      HOTEND_LOOP() power_delay_watch(watch_hotend[e], temp_hotend[e], dt);
+    #endif
+    #if WATCH_BED
+      power_delay_watch(watch_bed, temp_bed, dt);
+    #endif
+    #if WATCH_CHAMBER
+      power_delay_watch(watch_chamber, temp_chamber, dt);
+    #endif
+    UNUSED(dt);
+  }
+
+  /**
+   * Called by the ISR at the start of each PWM period to keep the heaters
+   * within HEATER_POWER_LIMIT. Heaters holding temperature get the power they
+   * ask for. Heaters still heating up share the rest in proportion to their
+   * request. Each on-time starts where the previous one ends so the load is
+   * spread over the period instead of all heaters switching on together.
+   */
+  void Temperature::budget_soft_pwm() {
+    const power_order_t &po = power_order[power_order_sel];
+    const uint8_t hold = po.hold_count;
+
+    uint32_t budget = uint32_t(HEATER_POWER_LIMIT) * 127, want = 0;
+    for (uint8_t k = hold; k < NR_POWER_HEATERS; ++k)
+      want += uint32_t(power_watts(po.heater[k])) * _MIN(power_heater(po.heater[k]).soft_pwm_amount, 127U);
+
+    uint32_t share = budget;
+    uint8_t phase = 0;
+    for (uint8_t k = 0; k < NR_POWER_HEATERS; ++k) {
+      const uint8_t i = po.heater[k];
+      heater_info_t &h = power_heater(i);
+      const uint16_t w = power_watts(i);
+      if (k == hold) share = budget;              // What's left after the holding heaters
+      uint32_t amount = _MIN(h.soft_pwm_amount, 127U);
+      if (k >= hold && want > share) amount = amount * share / want;
+      NOMORE(amount, budget / w);
+      h.soft_pwm_granted = amount;
+      h.soft_pwm_phase = phase;
+      budget -= w * amount;
+      phase += amount;
+      if (phase >= 127) phase -= 127;
+    }
+
+    TERN_(HAS_COOLER, temp_cooler.soft_pwm_granted = temp_cooler.soft_pwm_amount);
+  }
+
+#endif // HEATER_POWER_BUDGET
+
 /**
  * Handle various ~1kHz tasks associated with temperature
  *  - Check laser safety timeout
@@ -3897,13 +4499,15 @@ void Temperature::isr() {
   static int8_t temp_count = -1;
   static ADCSensorState adc_sensor_state = StartupDelay;
 
-  #ifndef SOFT_PWM_SCALE
-    #define SOFT_PWM_SCALE 0
-  #endif
-  static uint8_t pwm_count = _BV(SOFT_PWM_SCALE);
+  #if DISABLED(SOFT_PWM_SIGMA_DELTA)
+    #ifndef SOFT_PWM_SCALE
+      #define SOFT_PWM_SCALE 0
+    #endif
+    static uint8_t pwm_count = _BV(SOFT_PWM_SCALE);
 
-  // Avoid multiple loads of pwm_count
-  uint8_t pwm_count_tmp = pwm_count;
+    // Avoid multiple loads of pwm_count
+    uint8_t pwm_count_tmp = pwm_count;
+  #endif
 
   #if HAS_ADC_BUTTONS
     static raw_adc_t raw_ADCKey_value = 0;
@@ -3932,14 +4536,82 @@ void Temperature::isr() {
 
   #define WRITE_FAN(n, v) WRITE(FAN##n##_PIN, (v) ^ ENABLED(FAN_INVERTING))
 
-  #if DISABLED(SLOW_PWM_HEATERS)
+  #if ENABLED(SOFT_PWM_SIGMA_DELTA)
+
+    /**
+     * Sigma-delta heater and fan modulation, updated on every tick
+     */
+    #define _PWM_SD(N,S,T) WRITE_HEATER_##N(sigma_delta(S.count, T.soft_pwm_amount, 127))
+
+    #if HAS_HOTEND
+      #define _PWM_SD_E(N) SOFT_PWM_HEATER(N, temp_hotend[N]) _PWM_SD(N, soft_pwm_hotend[N], temp_hotend[N]);
+      REPEAT(HOTENDS, _PWM_SD_E);
+    #endif
+
+    #if HAS_HEATED_BED
+      SOFT_PWM_HEATER(HOTENDS, temp_bed) _PWM_SD(BED, soft_pwm_bed, temp_bed);
+      #if ENABLED(PELTIER_BED)
+        WRITE_PELTIER_DIR(temp_bed.peltier_dir_heating);
+      #endif
+    #endif
+
+    #if HAS_HEATED_CHAMBER
+      _PWM_SD(CHAMBER, soft_pwm_chamber, temp_chamber);
+    #endif
+
+    #if HAS_COOLER
+      _PWM_SD(COOLER, soft_pwm_cooler, temp_cooler);
+    #endif
+
+    #if ENABLED(FAN_SOFT_PWM)
+
+      #if ENABLED(USE_CONTROLLER_FAN)
+        WRITE(CONTROLLER_FAN_PIN, sigma_delta(soft_pwm_controller.count, controllerFan.soft_pwm_speed, 255));
+      #endif
+
+      #define _FAN_SD(N) WRITE_FAN(N, sigma_delta(soft_pwm_count_fan[N], soft_pwm_amount_fan[N], 255))
+
+      #if HAS_FAN0
+        _FAN_SD(0);
+      #endif
+      #if HAS_FAN1
+        _FAN_SD(1);
+      #endif
+      #if HAS_FAN2
+        _FAN_SD(2);
+      #endif
+      #if HAS_FAN3
+        _FAN_SD(3);
+      #endif
+      #if HAS_FAN4
+        _FAN_SD(4);
+      #endif
+      #if HAS_FAN5
+        _FAN_SD(5);
+      #endif
+      #if HAS_FAN6
+        _FAN_SD(6);
+      #endif
+      #if HAS_FAN7
+        _FAN_SD(7);
+      #endif
+    #endif
+
+  #elif DISABLED(SLOW_PWM_HEATERS)
 
     #if ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER, HAS_COOLER, FAN_SOFT_PWM)
       constexpr uint8_t pwm_mask = TERN0(SOFT_PWM_DITHER, _BV(SOFT_PWM_SCALE) - 1);
-      #define _PWM_MOD(N,S,T) do{                           \
-        const bool on = S.add(pwm_mask, T.soft_pwm_amount); \
-        WRITE_HEATER_##N(on);                               \
-      }while(0)
+      #if ENABLED(HEATER_POWER_BUDGET)
+        #define _PWM_MOD(N,S,T) do{                                \
+          S.add(pwm_mask, T.soft_pwm_granted);                     \
+          WRITE_HEATER_##N(S.on(pwm_count_tmp, T.soft_pwm_phase)); \
+        }while(0)
+      #else
+        #define _PWM_MOD(N,S,T) do{                           \
+          const bool on = S.add(pwm_mask, T.soft_pwm_amount); \
+          WRITE_HEATER_##N(on);                               \
+        }while(0)
+      #endif
     #endif
 
     /**
@@ -3948,13 +4620,15 @@ void Temperature::isr() {
     if (pwm_count_tmp >= 127) {
       pwm_count_tmp -= 127;
 
+      TERN_(HEATER_POWER_BUDGET, budget_soft_pwm());
+
       #if HAS_HOTEND
-        #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
+        #define _PWM_MOD_E(N) SOFT_PWM_HEATER(N, temp_hotend[N]) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
         REPEAT(HOTENDS, _PWM_MOD_E);
       #endif
 
       #if HAS_HEATED_BED
-        _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+        SOFT_PWM_HEATER(HOTENDS, temp_bed) _PWM_MOD(BED, soft_pwm_bed, temp_bed);
         #if ENABLED(PELTIER_BED)
           WRITE_PELTIER_DIR(temp_bed.peltier_dir_heating);
         #endif
@@ -4007,22 +4681,27 @@ void Temperature::isr() {
       #endif
     }
     else {
-      #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
+      #if ENABLED(HEATER_POWER_BUDGET)
+        // Check the amount too, so disable_all_heaters() takes effect mid-period
+        #define _PWM_LOW(N,S,T) WRITE_HEATER_##N(T.soft_pwm_amount && S.on(pwm_count_tmp, T.soft_pwm_phase))
+      #else
+        #define _PWM_LOW(N,S,T) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
+      #endif
       #if HAS_HOTEND
-        #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
+        #define _PWM_LOW_E(N) SOFT_PWM_PIN(N) _PWM_LOW(N, soft_pwm_hotend[N], temp_hotend[N]);
         REPEAT(HOTENDS, _PWM_LOW_E);
       #endif
 
       #if HAS_HEATED_BED
-        _PWM_LOW(BED, soft_pwm_bed);
+        SOFT_PWM_PIN(HOTENDS) _PWM_LOW(BED, soft_pwm_bed, temp_bed);
       #endif
 
       #if HAS_HEATED_CHAMBER
-        _PWM_LOW(CHAMBER, soft_pwm_chamber);
+        _PWM_LOW(CHAMBER, soft_pwm_chamber, temp_chamber);
       #endif
 
       #if HAS_COOLER
-        _PWM_LOW(COOLER, soft_pwm_cooler);
+        _PWM_LOW(COOLER, soft_pwm_cooler, temp_cooler);
       #endif
 
       #if ENABLED(FAN_SOFT_PWM)
@@ -4203,9 +4882,13 @@ void Temperature::isr() {
 
   //
   // Update lcd buttons 488 times per second
+  // and read one touch panel channel at the same rate
   //
   static bool do_buttons;
-  if ((do_buttons ^= true)) ui.update_buttons();
+  if ((do_buttons ^= true)) {
+    ui.update_buttons();
+    TERN_(TOUCH_ISR_SAMPLING, touchSampler.sample());
+  }
 
   /**
    * One sensor is sampled on every other call of the ISR.
@@ -4215,6 +4898,9 @@ void Temperature::isr() {
    * On the next pass, the ADC value is read and accumulated.
    *
    * This gives each ADC 0.9765ms to charge up.
+   *
+   * With ADC_SCAN_SAMPLING the HAL converts all sensors continuously and
+   * the thermal sensors are all accumulated at once in StartSampling.
    */
   #define ACCUMULATE_ADC(obj) do{ \
     if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; \
@@ -4254,82 +4940,87 @@ void Temperature::isr() {
         temp_count = 0;
         readings_ready();
       }
+      TERN_(ADC_SCAN_SAMPLING, sample_adc_scan());        // All thermal sensors in one pass
       break;
 
-    #if HAS_TEMP_ADC_0
-      case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
-      case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
-    #endif
+    #if DISABLED(ADC_SCAN_SAMPLING)
 
-    #if HAS_TEMP_ADC_BED
-      case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
-      case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
-    #endif
+      #if HAS_TEMP_ADC_0
+        case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
+        case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_CHAMBER
-      case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
-      case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
-    #endif
+      #if HAS_TEMP_ADC_BED
+        case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
+        case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
+      #endif
 
-    #if HAS_TEMP_ADC_COOLER
-      case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
-      case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
-    #endif
+      #if HAS_TEMP_ADC_CHAMBER
+        case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
+        case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
+      #endif
 
-    #if HAS_TEMP_ADC_PROBE
-      case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
-      case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
-    #endif
+      #if HAS_TEMP_ADC_COOLER
+        case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
+        case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
+      #endif
 
-    #if HAS_TEMP_ADC_BOARD
-      case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
-      case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
-    #endif
+      #if HAS_TEMP_ADC_PROBE
+        case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
+        case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
+      #endif
 
-    #if HAS_TEMP_ADC_SOC
-      case PrepareTemp_SOC: hal.adc_start(TEMP_SOC_PIN); break;
-      case MeasureTemp_SOC: ACCUMULATE_ADC(temp_soc); break;
-    #endif
+      #if HAS_TEMP_ADC_BOARD
+        case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
+        case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
+      #endif
 
-    #if HAS_TEMP_ADC_REDUNDANT
-      case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
-      case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
-    #endif
+      #if HAS_TEMP_ADC_SOC
+        case PrepareTemp_SOC: hal.adc_start(TEMP_SOC_PIN); break;
+        case MeasureTemp_SOC: ACCUMULATE_ADC(temp_soc); break;
+      #endif
 
-    #if HAS_TEMP_ADC_1
-      case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
-      case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
-    #endif
+      #if HAS_TEMP_ADC_REDUNDANT
+        case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
+        case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
+      #endif
 
-    #if HAS_TEMP_ADC_2
-      case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
-      case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
-    #endif
+      #if HAS_TEMP_ADC_1
+        case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
+        case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_3
-      case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
-      case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
-    #endif
+      #if HAS_TEMP_ADC_2
+        case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
+        case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_4
-      case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
-      case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
-    #endif
+      #if HAS_TEMP_ADC_3
+        case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
+        case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_5
-      case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
-      case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
-    #endif
+      #if HAS_TEMP_ADC_4
+        case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
+        case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_6
-      case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
-      case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
-    #endif
+      #if HAS_TEMP_ADC_5
+        case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
+        case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_7
-      case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
-      case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
-    #endif
+      #if HAS_TEMP_ADC_6
+        case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
+        case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
+      #endif
+
+      #if HAS_TEMP_ADC_7
+        case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
+        case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
+      #endif
+
+    #endif // !ADC_SCAN_SAMPLING
 
     #if ENABLED(FILAMENT_WIDTH_SENSOR)
       case Prepare_FILWIDTH: hal.adc_start(FILWIDTH_PIN); break;
@@ -4541,6 +5232,32 @@ void Temperature::isr() {
       print_heater_states(active_extruder OPTARG(HAS_TEMP_REDUNDANT, ENABLED(AUTO_REPORT_REDUNDANT)));
       SERIAL_EOL();
     }
+
+    #if ENABLED(THERMAL_TRACE)
+
+      bool Temperature::thermal_trace; // = false
+
+      /**
+       * Log the heater state after each temperature update, one line per heater:
+       *   TT:<ms>,<heater>,<°C>,<target °C>,<power 0-127>,<fan 0-255>,<E mm>
+       * where <heater> is the hotend index or -1 for the bed. The power is the
+       * on-time actually driven, which may be cut by HEATER_POWER_BUDGET.
+       * Read by buildroot/share/scripts/thermal_fit.py to fit a heater model.
+       */
+      void Temperature::report_thermal_trace(const millis_t ms) {
+        if (!thermal_trace) return;
+        const float e_mm = TERN0(HAS_EXTRUDERS, stepper.position(E_AXIS) * planner.mm_per_step[E_AXIS]);
+        auto trace = [&](const int8_t h, const celsius_float_t c, const heater_info_t &heater, const uint8_t fan) {
+          const uint8_t pwm = TERN(HEATER_POWER_BUDGET, heater.soft_pwm_granted, heater.soft_pwm_amount);
+          SERIAL_ECHOLN(F("TT:"), ms, C(','), int(h), C(','), p_float_t(c, 2), C(','), heater.target, C(','), int(pwm), C(','), int(fan), C(','), p_float_t(e_mm, 3));
+        };
+        #if HAS_HOTEND
+          HOTEND_LOOP() trace(e, degHotend(e), temp_hotend[e], TERN0(HAS_FAN, fan_speed[_MIN(e, FAN_COUNT - 1)]));
+        #endif
+        TERN_(HAS_HEATED_BED, trace(H_BED, degBed(), temp_bed, 0));
+      }
+
+    #endif
   #endif
 
   #if HAS_HOTEND && HAS_STATUS_MESSAGE
@@ -4842,6 +5559,75 @@ void Temperature::isr() {
 
   #endif // HAS_HEATED_BED
 
+  #if ENABLED(HEATUP_AND_CONTINUE)
+
+    uint16_t Temperature::deferred_heatup; // = 0
+
+    #if ENABLED(MPCTEMP)
+      /**
+       * Use the MPC model to estimate the time for the hotend block to reach
+       * the target at full power. Return 0 if the model can't reach the target.
+       */
+      millis_t Temperature::hotend_heatup_ms(const uint8_t e) {
+        const hotend_info_t &hotend = temp_hotend[e];
+        const MPC_t &mpc = hotend.mpc;
+        const float h = mpc.ambient_xfer_coeff_fan0;
+        if (h <= 0) return 0;
+        const float full = hotend.modeled_ambient_temp + mpc.heater_power / h, // Steady state at full power
+                    from = hotend.modeled_block_temp, to = hotend.target;
+        if (to <= from || to >= full) return 0;
+        return SEC_TO_MS(mpc.block_heat_capacity / h * logf((full - from) / (full - to)));
+      }
+    #endif
+
+    /**
+     * Let M109 / M190 return while the heater comes up to temperature.
+     * The planner calls finish_deferred_heatup() before the next extruding move.
+     */
+    void Temperature::defer_heatup(const heater_id_t heater_id) {
+      SERIAL_ECHO_START();
+      #if HAS_HEATED_BED
+        if (heater_id == H_BED) {
+          SBI(deferred_heatup, HOTENDS);
+          SERIAL_ECHOLNPGM("Bed heating. Continuing.");
+          return;
+        }
+      #endif
+      SBI(deferred_heatup, heater_id);
+      SERIAL_ECHOPGM("E", int(heater_id), " heating. Continuing.");
+      #if ENABLED(MPCTEMP)
+        const millis_t ms = hotend_heatup_ms(heater_id);
+        if (ms) SERIAL_ECHOPGM(" Ready in about ", ms / 1000, "s.");
+      #endif
+      SERIAL_EOL();
+    }
+
+    /**
+     * Wait for the bed and the hotend about to extrude. Other hotends stay
+     * pending until they extrude.
+     */
+    void Temperature::finish_deferred_heatup(const uint8_t extruder) {
+      if (!deferred_heatup) return;
+      #if HAS_HEATED_BED
+        if (TEST(deferred_heatup, HOTENDS)) {
+          CBI(deferred_heatup, HOTENDS);
+          LCD_MESSAGE(MSG_BED_HEATING);
+          wait_for_bed();
+        }
+      #endif
+      #if HAS_TEMP_HOTEND
+        const uint8_t e = TERN(HAS_MULTI_HOTEND, extruder, 0);
+        if (TEST(deferred_heatup, e)) {
+          CBI(deferred_heatup, e);
+          set_heating_message(e);
+          wait_for_hotend(e);
+        }
+      #endif
+      UNUSED(extruder);
+    }
+
+  #endif // HEATUP_AND_CONTINUE
+
   #if HAS_TEMP_PROBE
 
     #ifndef MIN_DELTA_SLOPE_DEG_PROBE
@@ -64,51 +64,53 @@ typedef int_fast8_t heater_id_t;
  */
 enum ADCSensorState : char {
   StartSampling,
-  #if HAS_TEMP_ADC_0
-    PrepareTemp_0, MeasureTemp_0,
-  #endif
-  #if HAS_TEMP_ADC_BED
-    PrepareTemp_BED, MeasureTemp_BED,
-  #endif
-  #if HAS_TEMP_ADC_CHAMBER
-    PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
-  #endif
-  #if HAS_TEMP_ADC_COOLER
-    PrepareTemp_COOLER, MeasureTemp_COOLER,
-  #endif
-  #if HAS_TEMP_ADC_PROBE
-    PrepareTemp_PROBE, MeasureTemp_PROBE,
-  #endif
-  #if HAS_TEMP_ADC_BOARD
-    PrepareTemp_BOARD, MeasureTemp_BOARD,
-  #endif
-  #if HAS_TEMP_ADC_SOC
-    PrepareTemp_SOC, MeasureTemp_SOC,
-  #endif
-  #if HAS_TEMP_ADC_REDUNDANT
-    PrepareTemp_REDUNDANT, MeasureTemp_REDUNDANT,
-  #endif
-  #if HAS_TEMP_ADC_1
-    PrepareTemp_1, MeasureTemp_1,
-  #endif
-  #if HAS_TEMP_ADC_2
-    PrepareTemp_2, MeasureTemp_2,
-  #endif
-  #if HAS_TEMP_ADC_3
-    PrepareTemp_3, MeasureTemp_3,
-  #endif
-  #if HAS_TEMP_ADC_4
-    PrepareTemp_4, MeasureTemp_4,
-  #endif
-  #if HAS_TEMP_ADC_5
-    PrepareTemp_5, MeasureTemp_5,
-  #endif
-  #if HAS_TEMP_ADC_6
-    PrepareTemp_6, MeasureTemp_6,
-  #endif
-  #if HAS_TEMP_ADC_7
-    PrepareTemp_7, MeasureTemp_7,
-  #endif
+  #if DISABLED(ADC_SCAN_SAMPLING) // Thermal sensors are sampled as a batch in StartSampling
+    #if HAS_TEMP_ADC_0
+      PrepareTemp_0, MeasureTemp_0,
+    #endif
+    #if HAS_TEMP_ADC_BED
+      PrepareTemp_BED, MeasureTemp_BED,
+    #endif
+    #if HAS_TEMP_ADC_CHAMBER
+      PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
+    #endif
+    #if HAS_TEMP_ADC_COOLER
+      PrepareTemp_COOLER, MeasureTemp_COOLER,
+    #endif
+    #if HAS_TEMP_ADC_PROBE
+      PrepareTemp_PROBE, MeasureTemp_PROBE,
+    #endif
+    #if HAS_TEMP_ADC_BOARD
+      PrepareTemp_BOARD, MeasureTemp_BOARD,
+    #endif
+    #if HAS_TEMP_ADC_SOC
+      PrepareTemp_SOC, MeasureTemp_SOC,
+    #endif
+    #if HAS_TEMP_ADC_REDUNDANT
+      PrepareTemp_REDUNDANT, MeasureTemp_REDUNDANT,
+    #endif
+    #if HAS_TEMP_ADC_1
+      PrepareTemp_1, MeasureTemp_1,
+    #endif
+    #if HAS_TEMP_ADC_2
+      PrepareTemp_2, MeasureTemp_2,
+    #endif
+    #if HAS_TEMP_ADC_3
+      PrepareTemp_3, MeasureTemp_3,
+    #endif
+    #if HAS_TEMP_ADC_4
+      PrepareTemp_4, MeasureTemp_4,
+    #endif
+    #if HAS_TEMP_ADC_5
+      PrepareTemp_5, MeasureTemp_5,
+    #endif
+    #if HAS_TEMP_ADC_6
+      PrepareTemp_6, MeasureTemp_6,
+    #endif
+    #if HAS_TEMP_ADC_7
+      PrepareTemp_7, MeasureTemp_7,
+    #endif
+  #endif // !ADC_SCAN_SAMPLING
   #if HAS_JOY_ADC_X
     PrepareJoy_X, MeasureJoy_X,
   #endif
@@ -387,6 +389,9 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
 
   typedef struct MPC {
     static bool e_paused;               // Pause E filament permm tracking
+    #if ENABLED(MPC_FAULT_DETECTION)
+      static bool fault_paused;         // Pause model fault detection
+    #endif
     static int32_t e_position;          // For E tracking
     float heater_power;                 // M306 P
     float block_heat_capacity;          // M306 C
@@ -440,6 +445,9 @@ typedef struct HeaterInfo : public TempInfo {
   #if ENABLED(PELTIER_BED)
     bool peltier_dir_heating; // = false
   #endif
+  #if ENABLED(HEATER_POWER_BUDGET)
+    uint8_t soft_pwm_granted, soft_pwm_phase; // Budgeted on-time and its start in the PWM period
+  #endif
 } heater_info_t;
 
 // A heater with PID stabilization
@@ -454,6 +462,10 @@ struct PIDHeaterInfo : public HeaterInfo {
     float modeled_ambient_temp,
           modeled_block_temp,
           modeled_sensor_temp;
+    #if ENABLED(MPC_FAULT_DETECTION)
+      float fault_low, fault_high;      // Accumulated error (K) below and above the model
+      bool fan_warned;
+    #endif
     float fanCoefficient() { return mpc.fanCoefficient(); }
     void applyFanAdjustment(const_float_t cf) { mpc.applyFanAdjustment(cf); }
   };
@@ -831,6 +843,7 @@ class Temperature {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        user_thermistor[t_index].pre_calc = true;
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
@@ -934,6 +947,9 @@ class Temperature {
      */
     static void isr();
     static void readings_ready();
+    #if ENABLED(ADC_SCAN_SAMPLING)
+      static void sample_adc_scan();
+    #endif
 
     /**
      * Call periodically to manage heaters and keep the watchdog fed
@@ -1089,6 +1105,15 @@ class Temperature {
 
     #endif // HAS_HEATED_BED
 
+    #if ENABLED(HEATUP_AND_CONTINUE)
+      static uint16_t deferred_heatup; // Hotends (bit e) and bed (bit HOTENDS) to wait for before extruding
+      static void defer_heatup(const heater_id_t heater_id);
+      static void finish_deferred_heatup(const uint8_t extruder);
+      #if ENABLED(MPCTEMP)
+        static millis_t hotend_heatup_ms(const uint8_t e);
+      #endif
+    #endif
+
     #if HAS_TEMP_PROBE
       #if ENABLED(SHOW_TEMP_ADC_VALUES)
         static raw_adc_t rawProbeTemp()  { return temp_probe.getraw(); }
@@ -1325,9 +1350,19 @@ class Temperature {
       #if ENABLED(AUTO_REPORT_TEMPERATURES)
         struct AutoReportTemp { static void report(); };
         static AutoReporter<AutoReportTemp> auto_reporter;
+        #if ENABLED(THERMAL_TRACE)
+          static bool thermal_trace;
+          static void report_thermal_trace(const millis_t ms);
+        #endif
       #endif
     #endif
 
+    #if ENABLED(MAX_TC_SCHEDULER)
+      // One slot per board: the hotend chip selects 0-2 and the bed
+      enum MaxTCSlot : uint8_t { MAX_TC_SLOT_0, MAX_TC_SLOT_1, MAX_TC_SLOT_2, MAX_TC_SLOT_BED, MAX_TC_SLOTS };
+      static void report_max_tc_bus();
+    #endif
+
     #if HAS_HOTEND && HAS_STATUS_MESSAGE
       static void set_heating_message(const uint8_t e, const bool isM104=false);
     #else
@@ -1363,6 +1398,10 @@ class Temperature {
     #if TEMP_SENSOR_IS_MAX_TC(BED)
       static raw_adc_t read_max_tc_bed();
     #endif
+    #if ENABLED(MAX_TC_SCHEDULER)
+      static raw_adc_t max_tc_raw[MAX_TC_SLOTS];
+      static void max_tc_service();
+    #endif
 
     #if HAS_AUTO_FAN
       #if ENABLED(POWER_OFF_WAIT_FOR_COOLDOWN)
@@ -1374,6 +1413,9 @@ class Temperature {
     #if HAS_HOTEND
       static float get_pid_output_hotend(const uint8_t e);
     #endif
+    #if ENABLED(MPC_FAULT_DETECTION)
+      static void check_mpc_fault(const uint8_t e, const float error, const float fan_fraction);
+    #endif
     #if ENABLED(PIDTEMPBED)
       static float get_pid_output_bed();
     #endif
@@ -1381,6 +1423,37 @@ class Temperature {
       static float get_pid_output_chamber();
     #endif
 
+    #if ENABLED(HEATER_POWER_BUDGET)
+      // Indices and size for the heater power budget
+      enum PowerIndex : int8_t {
+        _PWI = -1
+
+        #define _POWER_INDEX_E(N) ,POWER_INDEX_E##N
+        REPEAT(HOTENDS, _POWER_INDEX_E)
+        #undef _POWER_INDEX_E
+
+        OPTARG(HAS_HEATED_BED, POWER_INDEX_BED)
+        OPTARG(HAS_HEATED_CHAMBER, POWER_INDEX_CHAMBER)
+
+        , NR_POWER_HEATERS
+      };
+
+      typedef struct { uint8_t heater[NR_POWER_HEATERS], hold_count; } power_order_t;
+      static power_order_t power_order[2];    // One for the ISR to read while the other is rebuilt
+      static volatile uint8_t power_order_sel; // The one the ISR reads
+      static heater_info_t& power_heater(const uint8_t i);
+      static uint16_t power_watts(const uint8_t i);
+      static void update_power_order(const millis_t &ms);
+      static void budget_soft_pwm();
+    #endif
+
+    #if ENABLED(HARDWARE_PWM_HEATERS)
+      static uint16_t hardware_pwm_mask;  // Hotends (by index) and bed (HOTENDS) on hardware PWM pins
+      static uint8_t hardware_pwm_duty[HOTENDS + ENABLED(HAS_HEATED_BED)];
+      static void init_hardware_pwm();
+      static bool hardware_pwm(const uint8_t h, const uint8_t amount);
+    #endif
+
     static void _temp_error(const heater_id_t e, FSTR_P const serial_msg, FSTR_P const lcd_msg OPTARG(ERR_INCLUDE_TEMP, const celsius_float_t deg));
     static void mintemp_error(const heater_id_t e OPTARG(ERR_INCLUDE_TEMP, const celsius_float_t deg));
     static void maxtemp_error(const heater_id_t e OPTARG(ERR_INCLUDE_TEMP, const celsius_float_t deg));
@@ -42,6 +42,49 @@
 
 typedef struct { raw_adc_t value; celsius_t celsius; } temp_entry_t;
 
+#if ENABLED(THERMISTOR_DIRECT_INDEX)
+
+  /**
+   * Direct index into the thermistor tables
+   *
+   * The raw range is split into 2^THERMISTOR_INDEX_BITS equal parts, indexed
+   * by the high bits of the raw value. For each part a table built at compile
+   * time holds the table segment containing its lowest raw value, so finding
+   * the segment for a raw value takes a lookup and a few steps forward instead
+   * of a bisection.
+   */
+  #define THERMISTOR_RAW_BITS (HAL_ADC_RESOLUTION + TERN(HAL_ADC_FILTERED, 0, 4))
+  #define THERMISTOR_INDEX_BITS 8
+  #define THERMISTOR_INDEX_SHIFT (THERMISTOR_RAW_BITS - (THERMISTOR_INDEX_BITS))
+
+  // Compile-time integer sequence 0..N-1 (for C++11)
+  template<unsigned...> struct tt_seq {};
+  template<typename A, typename B> struct tt_cat;
+  template<unsigned... A, unsigned... B> struct tt_cat<tt_seq<A...>, tt_seq<B...>> { typedef tt_seq<A..., (sizeof...(A) + B)...> type; };
+  template<unsigned N> struct tt_make_seq : tt_cat<typename tt_make_seq<N / 2>::type, typename tt_make_seq<N - N / 2>::type> {};
+  template<> struct tt_make_seq<0> { typedef tt_seq<> type; };
+  template<> struct tt_make_seq<1> { typedef tt_seq<0> type; };
+
+  // Index of the last entry with a value not over 'raw'
+  constexpr uint8_t tt_segment(const temp_entry_t * const t, const uint8_t len, const uint32_t raw, const uint8_t i=0) {
+    return (i + 1 < len && t[i + 1].value <= raw) ? tt_segment(t, len, raw, i + 1) : i;
+  }
+
+  template<const temp_entry_t *TBL, uint8_t LEN, typename S=typename tt_make_seq<_BV(THERMISTOR_INDEX_BITS)>::type>
+  struct thermistor_index;
+
+  template<const temp_entry_t *TBL, uint8_t LEN, unsigned... I>
+  struct thermistor_index<TBL, LEN, tt_seq<I...>> { static const uint8_t table[sizeof...(I)]; };
+
+  template<const temp_entry_t *TBL, uint8_t LEN, unsigned... I>
+  const uint8_t thermistor_index<TBL, LEN, tt_seq<I...>>::table[sizeof...(I)] PROGMEM = {
+    tt_segment(TBL, LEN, uint32_t(I) << (THERMISTOR_INDEX_SHIFT))...
+  };
+
+  #define TT_INDEX(TBL) (thermistor_index<TBL, COUNT(TBL)>::table)
+
+#endif
+
 // Pt1000 and Pt100 handling
 //
 // Rt=R0*(1+a*T+b*T*T) [for T>0]
@@ -245,65 +288,81 @@ typedef struct { raw_adc_t value; celsius_t celsius; } temp_entry_t;
 #if TEMP_SENSOR_0 > 0
   #define TEMPTABLE_0 TT_NAME(TEMP_SENSOR_0)
   #define TEMPTABLE_0_LEN COUNT(TEMPTABLE_0)
+  #define TEMPTABLE_0_INDEX TT_INDEX(TEMPTABLE_0)
 #else
   #define TEMPTABLE_0 nullptr
   #define TEMPTABLE_0_LEN 0
+  #define TEMPTABLE_0_INDEX nullptr
 #endif
 
 #if TEMP_SENSOR_1 > 0
   #define TEMPTABLE_1 TT_NAME(TEMP_SENSOR_1)
   #define TEMPTABLE_1_LEN COUNT(TEMPTABLE_1)
+  #define TEMPTABLE_1_INDEX TT_INDEX(TEMPTABLE_1)
 #else
   #define TEMPTABLE_1 nullptr
   #define TEMPTABLE_1_LEN 0
+  #define TEMPTABLE_1_INDEX nullptr
 #endif
 
 #if TEMP_SENSOR_2 > 0
   #define TEMPTABLE_2 TT_NAME(TEMP_SENSOR_2)
   #define TEMPTABLE_2_LEN COUNT(TEMPTABLE_2)
+  #define TEMPTABLE_2_INDEX TT_INDEX(TEMPTABLE_2)
 #else
   #define TEMPTABLE_2 nullptr
   #define TEMPTABLE_2_LEN 0
+  #define TEMPTABLE_2_INDEX nullptr
 #endif
 
 #if TEMP_SENSOR_3 > 0
   #define TEMPTABLE_3 TT_NAME(TEMP_SENSOR_3)
   #define TEMPTABLE_3_LEN COUNT(TEMPTABLE_3)
+  #define TEMPTABLE_3_INDEX TT_INDEX(TEMPTABLE_3)
 #else
   #define TEMPTABLE_3 nullptr
   #define TEMPTABLE_3_LEN 0
+  #define TEMPTABLE_3_INDEX nullptr
 #endif
 
 #if TEMP_SENSOR_4 > 0
   #define TEMPTABLE_4 TT_NAME(TEMP_SENSOR_4)
   #define TEMPTABLE_4_LEN COUNT(TEMPTABLE_4)
+  #define TEMPTABLE_4_INDEX TT_INDEX(TEMPTABLE_4)
 #else
   #define TEMPTABLE_4 nullptr
   #define TEMPTABLE_4_LEN 0
+  #define TEMPTABLE_4_INDEX nullptr
 #endif
 
 #if TEMP_SENSOR_5 > 0
   #define TEMPTABLE_5 TT_NAME(TEMP_SENSOR_5)
   #define TEMPTABLE_5_LEN COUNT(TEMPTABLE_5)
+  #define TEMPTABLE_5_INDEX TT_INDEX(TEMPTABLE_5)
 #else
   #define TEMPTABLE_5 nullptr
   #define TEMPTABLE_5_LEN 0
+  #define TEMPTABLE_5_INDEX nullptr
 #endif
 
 #if TEMP_SENSOR_6 > 0
   #define TEMPTABLE_6 TT_NAME(TEMP_SENSOR_6)
   #define TEMPTABLE_6_LEN COUNT(TEMPTABLE_6)
+  #define TEMPTABLE_6_INDEX TT_INDEX(TEMPTABLE_6)
 #else
   #define TEMPTABLE_6 nullptr
   #define TEMPTABLE_6_LEN 0
+  #define TEMPTABLE_6_INDEX nullptr
 #endif
 
 #if TEMP_SENSOR_7 > 0
   #define TEMPTABLE_7 TT_NAME(TEMP_SENSOR_7)
   #define TEMPTABLE_7_LEN COUNT(TEMPTABLE_7)
+  #define TEMPTABLE_7_INDEX TT_INDEX(TEMPTABLE_7)
 #else
   #define TEMPTABLE_7 nullptr
   #define TEMPTABLE_7_LEN 0
+  #define TEMPTABLE_7_INDEX nullptr
 #endif
 
 #if TEMP_SENSOR_BED > 0
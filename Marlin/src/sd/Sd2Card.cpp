@@ -121,6 +121,11 @@
 // Send command and return error code. Return zero for OK
 uint8_t DiskIODriver_SPI_SD::cardCommand(const uint8_t cmd, const uint32_t arg) {
 
+  #if ENABLED(SD_STREAM_READS)
+    // Any other command ends an open multi-block read
+    if (streamBlock_ && cmd != CMD12) streamStop();
+  #endif
+
   #if ENABLED(SDCARD_COMMANDS_SPLIT)
     if (cmd != CMD12) chipDeselect();
   #endif
@@ -286,6 +291,7 @@ bool DiskIODriver_SPI_SD::init(const uint8_t sckRateID, const pin_t chipSelectPi
 
   errorCode_ = type_ = 0;
   chipSelectPin_ = chipSelectPin;
+  TERN_(SD_STREAM_READS, streamBlock_ = lastBlock_ = 0);
 
   // 16-bit init start time allows over a minute
   #if SD_INIT_TIMEOUT
@@ -400,6 +406,61 @@ bool DiskIODriver_SPI_SD::readBlock(uint32_t blockNumber, uint8_t * const dst) {
     return 0 == SDHC_CardReadBlock(dst, blockNumber);
   #endif
 
+  #if ENABLED(SD_STREAM_READS)
+    const uint32_t start_us = micros();
+    const bool success = streamBlock(blockNumber, dst) || readSingleBlock(blockNumber, dst);
+    if (success) {
+      // Average the throughput over about a second of read time
+      readBytes_ += 512;
+      readMicros_ += micros() - start_us;
+      if (readMicros_ >= 1000000UL) {
+        readRate_ = readBytes_ / (readMicros_ / 1000UL);
+        readBytes_ = readMicros_ = 0;
+      }
+    }
+    return success;
+  #else
+    return readSingleBlock(blockNumber, dst);
+  #endif
+}
+
+#if ENABLED(SD_STREAM_READS)
+
+  /**
+   * Read a block from an open CMD18 stream if it follows the last block read,
+   * starting a new stream on the second sequential block. Any other block ends
+   * the stream and returns false so the caller reads it with CMD17.
+   */
+  bool DiskIODriver_SPI_SD::streamBlock(const uint32_t blockNumber, uint8_t * const dst) {
+    if (streamBlock_ && blockNumber != streamBlock_) streamStop();
+
+    if (!streamBlock_ && lastBlock_ && blockNumber == lastBlock_ + 1) {
+      if (readStart(blockNumber))
+        streamBlock_ = blockNumber;
+      else
+        errorCode_ = 0;
+    }
+
+    lastBlock_ = blockNumber;
+    if (!streamBlock_) return false;
+
+    if (readData(dst)) { streamBlock_++; return true; }
+
+    streamStop();             // Retry with a single block read
+    errorCode_ = 0;
+    return false;
+  }
+
+  // End the multi-block read opened by streamBlock()
+  void DiskIODriver_SPI_SD::streamStop() {
+    streamBlock_ = 0;
+    readStop();
+  }
+
+#endif
+
+// Read a single block with CMD17
+bool DiskIODriver_SPI_SD::readSingleBlock(uint32_t blockNumber, uint8_t * const dst) {
   if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9;   // Use address if not SDHC card
 
   #if ENABLED(SD_CHECK_AND_RETRY)
@@ -165,6 +165,10 @@ public:
 
   bool isReady() override { return ready; };
 
+  #if ENABLED(SD_STREAM_READS)
+    uint32_t readRate() override { return readRate_; }
+  #endif
+
   void idle() override {}
 
 private:
@@ -175,6 +179,16 @@ private:
           status_,
           type_;
 
+  #if ENABLED(SD_STREAM_READS)
+    uint32_t streamBlock_ = 0,  // Next block of the open CMD18 stream, 0 if none
+             lastBlock_ = 0,    // Last block read
+             readBytes_ = 0,    // Bytes read in the current rate window
+             readMicros_ = 0,   // Time spent reading in the current rate window
+             readRate_ = 0;     // Read throughput (KB/s)
+    bool streamBlock(const uint32_t blockNumber, uint8_t * const dst);
+    void streamStop();
+  #endif
+
   // private functions
   inline uint8_t cardAcmd(const uint8_t cmd, const uint32_t arg) {
     cardCommand(CMD55, 0);
@@ -183,6 +197,7 @@ private:
   uint8_t cardCommand(const uint8_t cmd, const uint32_t arg);
 
   bool readData(uint8_t * const dst, const uint16_t count);
+  bool readSingleBlock(uint32_t blockNumber, uint8_t * const dst);
   bool readRegister(const uint8_t cmd, void * const buf);
   void chipDeselect();
   void chipSelect();
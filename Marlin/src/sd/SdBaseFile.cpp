@@ -50,6 +50,7 @@ bool SdBaseFile::addCluster() {
   if (ENABLED(SDCARD_READONLY)) return false;
 
   if (!vol_->allocContiguous(1, &curCluster_)) return false;
+  TERN_(SD_CLUSTER_CACHE, invalidateClusterRuns());
 
   // if first cluster of file link to directory entry
   if (firstCluster_ == 0) {
@@ -96,6 +97,86 @@ dir_t* SdBaseFile::cacheDirEntry(const uint8_t action) {
   return vol_->cache()->dir + dirIndex_;
 }
 
+#if ENABLED(SD_CLUSTER_CACHE)
+
+  /**
+   * Follow the FAT from the walk position up to cluster index n, adding what
+   * is walked to the runs. Only the clusters between the walk position and n
+   * are read, so sequential reads cost one FAT lookup per cluster and the
+   * chain is never walked all at once. A contiguous file stays a single run.
+   * Once SD_CLUSTER_CACHE_RUNS runs are used the rest of the chain is walked
+   * but not cached.
+   *
+   * \return true for success, false for an I/O error, a corrupt chain, or n past the end.
+   */
+  bool SdBaseFile::walkClusterRuns(const uint32_t n) {
+    while (walkIndex_ < n) {
+      uint32_t next;
+      if (!vol_->fatGet(walkCluster_, &next) || vol_->isEOC(next)) return false;
+      if (++walkIndex_ > vol_->clusterCount()) return false;  // loop in the chain
+      if (walkIndex_ == runsEnd_) {                           // still caching?
+        if (next == walkCluster_ + 1)
+          runsEnd_++;
+        else if (runCount_ < SD_CLUSTER_CACHE_RUNS) {
+          runs_[runCount_++] = { walkIndex_, next };
+          runsEnd_++;
+        }
+      }
+      walkCluster_ = next;
+    }
+    return true;
+  }
+
+  /**
+   * Get the cluster holding cluster index n of the file.
+   * The last used run is tried first so sequential reads are O(1),
+   * otherwise the runs are binary searched.
+   *
+   * \param[in] n Cluster index from the start of the file.
+   * \param[out] cluster The cluster number.
+   *
+   * \return true for success, false for failure.
+   */
+  bool SdBaseFile::clusterAt(const uint32_t n, uint32_t * const cluster) {
+    if (!runCount_) {
+      if (firstCluster_ == 0) return false;
+      runs_[0] = { 0, firstCluster_ };
+      runCount_ = runsEnd_ = 1;
+      runHint_ = 0;
+      walkIndex_ = 0;
+      walkCluster_ = firstCluster_;
+    }
+
+    // Past the cached runs? Follow the FAT, from the last cached cluster if n is behind the walk.
+    if (n >= runsEnd_) {
+      if (n < walkIndex_) {
+        const cluster_run_t &last = runs_[runCount_ - 1];
+        walkIndex_ = runsEnd_ - 1;
+        walkCluster_ = last.cluster + (walkIndex_ - last.index);
+      }
+      if (!walkClusterRuns(n)) return false;
+      if (n >= runsEnd_) {
+        *cluster = walkCluster_;
+        return true;
+      }
+    }
+
+    uint8_t r = runHint_;
+    const uint32_t end = r + 1 < runCount_ ? runs_[r + 1].index : runsEnd_;
+    if (n < runs_[r].index || n >= end) {
+      uint8_t lo = 0, hi = runCount_ - 1;
+      while (lo < hi) {
+        const uint8_t mid = (lo + hi + 1) >> 1;
+        if (runs_[mid].index <= n) lo = mid; else hi = mid - 1;
+      }
+      runHint_ = r = lo;
+    }
+    *cluster = runs_[r].cluster + (n - runs_[r].index);
+    return true;
+  }
+
+#endif // SD_CLUSTER_CACHE
+
 /**
  * Close a file and force cached data and directory information
  *  to be written to the storage device.
@@ -941,6 +1022,7 @@ bool SdBaseFile::openCachedEntry(const uint8_t dirIndex, const uint8_t oflag) {
   // set to start of file
   curCluster_ = 0;
   curPosition_ = 0;
+  TERN_(SD_CLUSTER_CACHE, invalidateClusterRuns());
   if ((oflag & O_TRUNC) && !truncate(0)) return false;
   return oflag & O_AT_END ? seekEnd(0) : true;
 
@@ -1388,6 +1470,11 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
+        #if ENABLED(SD_CLUSTER_CACHE)
+          else if (isFile()) {                              // get next cluster from the run cache
+            if (!clusterAt(curPosition_ >> (vol_->clusterSizeShift_ + 9), &curCluster_)) return -1;
+          }
+        #endif
         else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
           return -1;
       }
@@ -1930,6 +2017,14 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  #if ENABLED(SD_CLUSTER_CACHE)
+    if (isFile()) {
+      if (!clusterAt(nNew, &curCluster_)) return false;
+      curPosition_ = pos;
+      return true;
+    }
+  #endif
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
@@ -2144,6 +2239,7 @@ bool SdBaseFile::truncate(uint32_t length) {
     }
   }
   fileSize_ = length;
+  TERN_(SD_CLUSTER_CACHE, invalidateClusterRuns());
 
   // need to update directory entry
   flags_ |= F_FILE_DIR_DIRTY;
@@ -369,6 +369,20 @@ class SdBaseFile {
   uint32_t  firstCluster_;  // first cluster of file
   SdVolume  *vol_;          // volume where file is located
 
+  #if ENABLED(SD_CLUSTER_CACHE)
+    // A run of consecutive clusters starting at cluster index 'index'
+    typedef struct { uint32_t index, cluster; } cluster_run_t;
+    cluster_run_t runs_[SD_CLUSTER_CACHE_RUNS]; // cluster runs in file order
+    uint32_t  runsEnd_;     // cluster index past the last cached cluster
+    uint32_t  walkIndex_,   // cluster index reached by following the FAT
+              walkCluster_; // the cluster at walkIndex_
+    uint8_t   runCount_;    // number of valid entries in runs_, 0 if not started
+    uint8_t   runHint_;     // run used by the last lookup
+    void invalidateClusterRuns() { runCount_ = 0; }
+    bool walkClusterRuns(const uint32_t n);
+    bool clusterAt(const uint32_t n, uint32_t * const cluster);
+  #endif
+
   /**
    * EXPERIMENTAL - Don't use!
    */
@@ -91,6 +91,11 @@ MediaFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_
 uint8_t CardReader::workDirDepth;
 int16_t CardReader::nrItems = -1;
 
+#if ENABLED(SD_DIR_INDEX)
+  CardReader::dir_index_t CardReader::dirIndex[SD_DIR_INDEX_LIMIT];
+  uint16_t CardReader::dirIndexEnd;
+#endif
+
 #if ENABLED(SDCARD_SORT_ALPHA)
 
   int16_t CardReader::sort_count;
@@ -235,14 +240,39 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
   );
 }
 
+#if ENABLED(SD_DIR_INDEX)
+
+  // Case-insensitive 16-bit FNV-1a hash of a DOS 8.3 name
+  uint16_t CardReader::nameHash(const char *name) {
+    uint32_t h = 2166136261UL;
+    while (*name) { h ^= uint8_t(toupper(*name++)); h *= 16777619UL; }
+    return uint16_t(h ^ (h >> 16));
+  }
+
+#endif
+
 //
 // Get the number of (compliant) items in the folder
+// With SD_DIR_INDEX also index the items for selectFileByIndex / selectFileByName.
 //
 int16_t CardReader::countVisibleItems(MediaFile dir) {
   dir_t p;
   int16_t c = 0;
   dir.rewind();
-  while (dir.readDir(&p, longFilename) > 0) c += is_visible_entity(p);
+  #if ENABLED(SD_DIR_INDEX)
+    char dosName[FILENAME_LENGTH];
+    dirIndexEnd = 0;
+    for (uint32_t pos = 0; dir.readDir(&p, longFilename) > 0; pos = dir.curPosition()) {
+      if (!is_visible_entity(p)) continue;
+      if (c < SD_DIR_INDEX_LIMIT) {
+        dirIndex[c] = { uint16_t(pos / sizeof(dir_t)), nameHash(createFilename(dosName, p)) };
+        dirIndexEnd = dir.curPosition() / sizeof(dir_t);
+      }
+      c++;
+    }
+  #else
+    while (dir.readDir(&p, longFilename) > 0) c += is_visible_entity(p);
+  #endif
   return c;
 }
 
@@ -771,6 +801,7 @@ void CardReader::openFileWrite(const char * const path) {
   #if DISABLED(SDCARD_READONLY)
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      nrItems = -1;
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -826,6 +857,7 @@ void CardReader::removeFile(const char * const name) {
     if (file.remove(itsDirPtr, fname)) {
       SERIAL_ECHOLNPGM("File deleted:", fname);
       sdpos = 0;
+      nrItems = -1;
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
     else
@@ -1014,6 +1046,20 @@ void CardReader::selectFileByIndex(const int16_t nr) {
       return;
     }
   #endif
+  #if ENABLED(SD_DIR_INDEX)
+    // Seek straight to an indexed item, or scan on from the last indexed item
+    if (WITHIN(nr, 0, get_num_items() - 1)) {
+      if (nr < SD_DIR_INDEX_LIMIT) {
+        workDir.seekSet(dirIndex[nr].entry * sizeof(dir_t));
+        selectByIndex(workDir, 0);
+      }
+      else {
+        workDir.seekSet(dirIndexEnd * sizeof(dir_t));
+        selectByIndex(workDir, nr - (SD_DIR_INDEX_LIMIT));
+      }
+      return;
+    }
+  #endif
   workDir.rewind();
   selectByIndex(workDir, nr);
 }
@@ -1032,6 +1078,20 @@ void CardReader::selectFileByName(const char * const match) {
         return;
       }
   #endif
+  #if ENABLED(SD_DIR_INDEX)
+    // Check indexed items with a matching hash, then scan any items past the index
+    const uint16_t hash = nameHash(match);
+    for (int16_t nr = 0; nr < _MIN(get_num_items(), int16_t(SD_DIR_INDEX_LIMIT)); nr++) {
+      if (dirIndex[nr].hash != hash) continue;
+      workDir.seekSet(dirIndex[nr].entry * sizeof(dir_t));
+      selectByIndex(workDir, 0);
+      if (strcasecmp(match, filename) == 0) return;
+    }
+    workDir.seekSet(dirIndexEnd * sizeof(dir_t));
+    selectByName(workDir, match);
+    if (strcasecmp(match, filename) != 0) filename[0] = longFilename[0] = '\0'; // Not found. Leave no stale name.
+    return;
+  #endif
   workDir.rewind();
   selectByName(workDir, match);
 }
@@ -1448,7 +1508,8 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    // The journal lives past the snapshot, so the file mustn't be truncated
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | TERN(POWER_LOSS_JOURNAL, 0, O_TRUNC) | O_SYNC))
       openFailed(recovery.filename);
     else if (!read)
       echo_write_to_file(recovery.filename);
@@ -1468,6 +1529,18 @@ void CardReader::fileHasFinished() {
     }
   }
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    // Replace the job recovery file with a new contiguous file, left open,
+    // so the journal can be written by block without going through the FAT.
+    bool CardReader::createJobRecoveryFile(const uint32_t size) {
+      if (!isMounted() || recovery.file.isOpen()) return false;
+      MediaFile::remove(&root, recovery.filename);
+      return recovery.file.createContiguous(&root, recovery.filename, size);
+    }
+
+  #endif
+
 #endif // POWER_LOSS_RECOVERY
 
 #endif // HAS_MEDIA
@@ -224,6 +224,9 @@ public:
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static bool createJobRecoveryFile(const uint32_t size);
+    #endif
   #endif
 
   // Binary flag for the current file
@@ -236,6 +239,8 @@ public:
 
   // Print File stats
   static uint32_t getFileSize()  { return filesize; }
+  static uint32_t getFileCluster() { return file.firstCluster(); }
+  static uint32_t getFileDateTime() { dir_t p; return file.dirEntry(&p) ? uint32_t(p.lastWriteDate) << 16 | p.lastWriteTime : 0; }
   static uint32_t getIndex()     { return sdpos; }
   static bool isFileOpen()       { return isMounted() && file.isOpen(); }
   static bool eof()              { return getIndex() >= getFileSize(); }
@@ -275,6 +280,19 @@ private:
   static uint8_t workDirDepth;
   static int16_t nrItems; // Cache the total count
 
+  //
+  // Index of the visible items in the working directory
+  //
+  #if ENABLED(SD_DIR_INDEX)
+    typedef struct {
+      uint16_t entry;       // First directory entry read for the item
+      uint16_t hash;        // Hash of the DOS 8.3 name
+    } dir_index_t;
+    static dir_index_t dirIndex[SD_DIR_INDEX_LIMIT];
+    static uint16_t dirIndexEnd; // Directory entry following the last indexed item
+    static uint16_t nameHash(const char *name);
+  #endif
+
   //
   // Alphabetical file and folder sorting
   //
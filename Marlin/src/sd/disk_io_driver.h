@@ -64,5 +64,12 @@ public:
 
   virtual bool isReady() = 0;
 
+  /**
+   * Measured block read throughput, if the driver keeps track of it.
+   *
+   * \return read rate in KB/s or 0 if unknown.
+   */
+  virtual uint32_t readRate() { return 0; }
+
   virtual void idle() = 0;
 };
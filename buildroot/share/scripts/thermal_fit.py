@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+"""Fit a heater model to a THERMAL_TRACE log and replay it
+
+Capture a log with 'M155 L1' (THERMAL_TRACE) while the heater is driven
+through a wide range of power, fan speed and extrusion. Then:
+
+  thermal_fit.py trace.log --power 40 --write hotend.plant
+      Fit the model and write a plant file for the native simulator.
+      Run the simulator with MARLIN_SIM_HOTEND=hotend.plant (and optionally
+      MARLIN_SIM_SPEED=10) to run M303 / M306 against the fitted heater.
+
+  thermal_fit.py trace.log --plant hotend.plant --max-rms 2
+      Replay the recorded inputs through an existing model and report
+      the error. Exits non-zero if the RMS error exceeds the limit.
+
+The model is the one used by HAL/LINUX/hardware/Heater.cpp:
+  C dTb/dt = P u - (h + hf fan + cf e') (Tb - Ta)
+    dTs/dt = r (Tb - Ts)
+"""
+
+import argparse, math, re, sys
+
+TRACE_RE = re.compile(r'TT:(\d+),(-?\d+),([-\d.]+),(-?\d+),(\d+),(\d+),([-\d.]+)')
+
+PLANT_KEYS = ('heater_power', 'heat_capacity', 'ambient_xfer', 'fan_xfer', 'filament_heat', 'sensor_response', 'ambient_temp')
+
+def read_trace(path, heater):
+    """Return [(seconds, celsius, power 0-1, fan 0-1, E mm)] for one heater"""
+    samples = []
+    with open(path, errors='replace') as f:
+        for line in f:
+            m = TRACE_RE.search(line)
+            if not m or int(m.group(2)) != heater: continue
+            ms, _, c, _, pwm, fan, e = m.groups()
+            t = int(ms) / 1000.0
+            if samples and t <= samples[-1][0]: continue
+            samples.append((t, float(c), int(pwm) / 127.0, int(fan) / 255.0, float(e)))
+    return samples
+
+def derivative(t, y, span):
+    """Central difference over about 'span' seconds, for noisy quantized readings"""
+    n, d, j0, j1 = len(t), [0.0] * len(t), 0, 0
+    for i in range(n):
+        while t[i] - t[j0] > span / 2: j0 += 1
+        while j1 < n - 1 and t[j1 + 1] - t[i] <= span / 2: j1 += 1
+        if t[j1] > t[j0]: d[i] = (y[j1] - y[j0]) / (t[j1] - t[j0])
+    return d
+
+def solve(A, b):
+    """Solve A x = b by Gaussian elimination with partial pivoting"""
+    n = len(b)
+    M = [row[:] + [b[i]] for i, row in enumerate(A)]
+    for c in range(n):
+        p = max(range(c, n), key=lambda r: abs(M[r][c]))
+        if abs(M[p][c]) < 1e-12: return None
+        M[c], M[p] = M[p], M[c]
+        for r in range(c + 1, n):
+            f = M[r][c] / M[c][c]
+            for k in range(c, n + 1): M[r][k] -= f * M[c][k]
+    x = [0.0] * n
+    for r in range(n - 1, -1, -1):
+        x[r] = (M[r][n] - sum(M[r][k] * x[k] for k in range(r + 1, n))) / M[r][r]
+    return x
+
+def least_squares(rows, y):
+    """Fit y = rows * x, dropping loss terms that come out negative"""
+    used = [j for j in range(len(rows[0])) if any(abs(row[j]) > 1e-9 for row in rows)]
+    while used:
+        A = [[sum(row[i] * row[j] for row in rows) for j in used] for i in used]
+        b = [sum(row[i] * v for row, v in zip(rows, y)) for i in used]
+        x = solve(A, b)
+        if not x: return None
+        coef = [0.0] * len(rows[0])
+        for j, v in zip(used, x): coef[j] = v
+        neg = [j for j in used[1:] if coef[j] < 0]
+        if not neg: return coef
+        used.remove(min(neg, key=lambda j: coef[j]))
+    return None
+
+def replay(samples, plant):
+    """Drive the model with the recorded inputs and return the RMS sensor error"""
+    P, C = plant['heater_power'], plant['heat_capacity']
+    Ta, r = plant['ambient_temp'], plant['sensor_response']
+    block = sensor = samples[0][1]
+    err = 0.0
+    for (t0, _, u, fan, e0), (t1, c1, _, _, e1) in zip(samples, samples[1:]):
+        dt, de = t1 - t0, max(e1 - e0, 0.0)
+        dtemp = block - Ta
+        loss = (plant['ambient_xfer'] + fan * plant['fan_xfer']) * dtemp * dt + plant['filament_heat'] * de * dtemp
+        block += (P * u * dt - loss) / C
+        sensor += (block - sensor) * min(r * dt, 1.0)
+        err += (sensor - c1) ** 2
+    return math.sqrt(err / max(len(samples) - 1, 1))
+
+def fit(samples, power, ambient, span):
+    """Least-squares fit of the block model for each sensor response, keeping the best replay"""
+    t = [s[0] for s in samples]
+    Ts = [s[1] for s in samples]
+    dTs = derivative(t, Ts, span)
+    de = derivative(t, [s[4] for s in samples], span)
+    # A fan that ran at one speed while hot can't be told apart from ambient loss
+    hot_fan = [s[3] for s in samples if s[1] > ambient + 10] or [0]
+    fan_varied = max(hot_fan) - min(hot_fan) > 0.1
+    best = None
+    for k in range(25):
+        r = 0.02 * 1.3 ** k                          # 0.02 .. 10 /s
+        Tb = [Ts[i] + dTs[i] / r for i in range(len(t))]
+        dTb = derivative(t, Tb, span)
+        # dTb/dt = a u - b dT - c fan dT - d e' dT
+        rows = [[s[2], -(Tb[i] - ambient), -s[3] * (Tb[i] - ambient) if fan_varied else 0, -max(de[i], 0.0) * (Tb[i] - ambient)] for i, s in enumerate(samples)]
+        coef = least_squares(rows, dTb)
+        if not coef or coef[0] <= 0: continue
+        C = power / coef[0]
+        plant = dict(zip(PLANT_KEYS, (power, C, coef[1] * C, coef[2] * C, coef[3] * C, r, ambient)))
+        rms = replay(samples, plant)
+        if best is None or rms < best[0]: best = (rms, plant)
+    if best and not fan_varied: print("# Fan speed didn't vary while hot. Fan loss is included in ambient_xfer.")
+    return best
+
+def read_plant(path):
+    plant = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r'\s*([a-z_]+)\s*=\s*([-+\d.eE]+)', line)
+            if m: plant[m.group(1)] = float(m.group(2))
+    missing = [k for k in PLANT_KEYS if k not in plant]
+    if missing: sys.exit(f"{path}: missing {', '.join(missing)}")
+    return plant
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('log', help="serial log containing TT: lines")
+    ap.add_argument('--heater', type=int, default=0, help="hotend index, or -1 for the bed (default 0)")
+    ap.add_argument('--power', type=float, default=40.0, help="heater power in watts (default 40)")
+    ap.add_argument('--ambient', type=float, help="ambient temperature (default: first reading)")
+    ap.add_argument('--span', type=float, default=2.0, help="derivative window in seconds (default 2)")
+    ap.add_argument('--plant', help="replay an existing plant file instead of fitting")
+    ap.add_argument('--write', help="write the fitted plant file")
+    ap.add_argument('--max-rms', type=float, help="fail if the replay RMS error (°C) exceeds this")
+    args = ap.parse_args()
+
+    samples = read_trace(args.log, args.heater)
+    if len(samples) < 10: sys.exit(f"{args.log}: not enough TT: samples for heater {args.heater}")
+
+    if args.plant:
+        plant = read_plant(args.plant)
+        rms = replay(samples, plant)
+    else:
+        ambient = samples[0][1] if args.ambient is None else args.ambient
+        best = fit(samples, args.power, ambient, args.span)
+        if not best: sys.exit("No fit found. Record more heating and cooling.")
+        rms, plant = best
+
+    for k in PLANT_KEYS: print(f"{k} = {plant[k]:.6g}")
+    print(f"# {len(samples)} samples, replay RMS error {rms:.3f} °C")
+
+    if args.write:
+        with open(args.write, 'w') as f:
+            f.write(f"# Fitted from {args.log}, replay RMS error {rms:.3f} °C\n")
+            for k in PLANT_KEYS: f.write(f"{k} = {plant[k]:.6g}\n")
+
+    if args.max_rms is not None and rms > args.max_rms:
+        sys.exit(f"Replay RMS error {rms:.3f} °C exceeds {args.max_rms} °C")
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+"""Time a scripted walk through the MarlinUI menus and compare frames
+
+Build with UI_RENDER_STATS. The native simulator works, and so does a
+real printer. The script file holds G-code lines plus a few directives:
+
+  M257 E3           Scroll down three menu items (negative scrolls up)
+  M257 C            Click the encoder button
+  M257 H            Return to the Status Screen
+  M257 X120 Y60     Tap a touch screen at this point (TOUCH_SCREEN)
+  @wait 500         Pause for a number of milliseconds
+  @mark main_menu   Let the screen settle, then record the last frame
+
+Blank lines and lines starting with '#' are ignored. Example:
+
+  M257 C
+  @mark main_menu
+  M257 E2
+  M257 C
+  @mark motion_menu
+  M257 H
+
+Run it against the simulator's serial port:
+
+  ui_bench.py /dev/pts/3 walk.txt --golden walk.json --update
+      Record the frame hashes of a known-good build.
+
+  ui_bench.py /dev/pts/3 walk.txt --golden walk.json --max-us 20000
+      Exits non-zero if a marked frame differs from the golden file,
+      or took longer than the limit to draw and send.
+
+Frames that show live values such as temperatures or times only hash
+the same when those values match, so mark menus rather than the
+Status Screen.
+"""
+
+import argparse, json, re, sys, time
+
+LAST_RE = re.compile(r'Last frame:(\S+) Time:(\d+)us Bytes:(\d+) Full:(\d+) Hash:([0-9A-F]+)')
+SCREEN_RE = re.compile(r'Screen (\S+) Frames:(\d+)')
+
+class Printer:
+    def __init__(self, port, baud, timeout):
+        import serial
+        self.ser = serial.Serial(port, baud, timeout=timeout)
+        self.timeout = timeout
+        time.sleep(0.5)
+        self.ser.reset_input_buffer()
+
+    def send(self, line):
+        """Send one line and return the lines received before its 'ok'"""
+        self.ser.write((line + '\n').encode())
+        reply, start = [], time.time()
+        while time.time() - start < self.timeout:
+            got = self.ser.readline().decode(errors='replace').strip()
+            if not got: continue
+            if got.startswith('ok'): return reply
+            reply.append(got)
+        sys.exit(f"No reply to '{line}'")
+
+def run(printer, script, settle):
+    """Run the script and return {mark: (screen, us, bytes, full, hash)} plus the final M257 report"""
+    marks = {}
+    printer.send('M257 R')
+    with open(script) as f:
+        for n, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith('#'): continue
+            if line.startswith('@wait'):
+                time.sleep(int(line.split()[1]) / 1000.0)
+            elif line.startswith('@mark'):
+                name = line.split()[1]
+                time.sleep(settle)
+                m = next(filter(None, (LAST_RE.search(r) for r in printer.send('M257'))), None)
+                if not m: sys.exit(f"{script}:{n}: no frame report. Is UI_RENDER_STATS enabled?")
+                marks[name] = (m.group(1), int(m.group(2)), int(m.group(3)), int(m.group(4)), m.group(5))
+            else:
+                printer.send(line)
+    return marks, [r for r in printer.send('M257') if SCREEN_RE.search(r)]
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('port', help="serial port of the printer or simulator")
+    ap.add_argument('script', help="file of G-code lines and @wait / @mark directives")
+    ap.add_argument('--baud', type=int, default=250000, help="baud rate (default 250000)")
+    ap.add_argument('--settle', type=float, default=1.0, help="seconds to wait before each mark (default 1)")
+    ap.add_argument('--timeout', type=float, default=10.0, help="seconds to wait for each 'ok' (default 10)")
+    ap.add_argument('--golden', help="JSON file of known-good frame hashes")
+    ap.add_argument('--update', action='store_true', help="write the hashes from this run to the golden file")
+    ap.add_argument('--max-us', type=int, help="fail if a marked frame took longer than this to draw and send")
+    args = ap.parse_args()
+
+    marks, screens = run(Printer(args.port, args.baud, args.timeout), args.script, args.settle)
+
+    print(f"{'mark':<24}{'time us':>10}{'bytes':>10}{'full':>6}  hash")
+    for name, (_, us, nbytes, full, h) in marks.items():
+        print(f"{name:<24}{us:>10}{nbytes:>10}{full:>6}  {h}")
+    for line in screens: print(line)
+
+    failed = []
+    if args.max_us is not None:
+        failed += [f"{name}: {m[1]}us exceeds {args.max_us}us" for name, m in marks.items() if m[1] > args.max_us]
+
+    if args.golden and args.update:
+        with open(args.golden, 'w') as f:
+            json.dump({name: m[4] for name, m in marks.items()}, f, indent=2)
+            f.write('\n')
+    elif args.golden:
+        with open(args.golden) as f: golden = json.load(f)
+        for name, h in golden.items():
+            if name not in marks: failed.append(f"{name}: not marked in this run")
+            elif marks[name][4] != h: failed.append(f"{name}: hash {marks[name][4]} differs from golden {h}")
+
+    if failed: sys.exit('\n'.join(failed))
+
+if __name__ == '__main__':
+    main()